@@ -0,0 +1,43 @@
+#include "geometry.h"
+#include "generators.h"
+
+#include "benchmark/benchmark.h"
+
+static void BM_Triangulation2OutputComplex(benchmark::State& state) {
+    geometricTriangulation2 T;
+    gen::insertPoints(T, gen::uniformCloud(state.range(0), 2, 42));
+
+    for (auto _ : state) {
+        auto C = T.outputComplex();
+        C.finalize();
+        benchmark::DoNotOptimize(C);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Triangulation2OutputComplex)->RangeMultiplier(4)->Range(1<<8, 1<<14)->Complexity();
+
+static void BM_Triangulation3OutputComplex(benchmark::State& state) {
+    geometricTriangulation3 T;
+    gen::insertPoints(T, gen::uniformCloud(state.range(0), 3, 42));
+
+    for (auto _ : state) {
+        auto C = T.outputComplex();
+        C.finalize();
+        benchmark::DoNotOptimize(C);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Triangulation3OutputComplex)->RangeMultiplier(4)->Range(1<<8, 1<<12)->Complexity();
+
+static void BM_Triangulation4OutputComplex(benchmark::State& state) {
+    geometricTriangulationD<4> T;
+    gen::insertPoints(T, gen::uniformCloud(state.range(0), 4, 42));
+
+    for (auto _ : state) {
+        auto C = T.outputComplex();
+        C.finalize();
+        benchmark::DoNotOptimize(C);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Triangulation4OutputComplex)->RangeMultiplier(4)->Range(1<<6, 1<<10)->Complexity();
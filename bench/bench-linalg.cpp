@@ -0,0 +1,92 @@
+#include <random>
+
+#include "linalg.h"
+#include "toprep.h"
+#include "generators.h"
+
+#include "benchmark/benchmark.h"
+
+using namespace la;
+
+// a sparse vector with roughly density*dim non-zero entries
+static TernaryVector randomVector(const int& dim, const double& density, std::mt19937& gen) {
+    std::bernoulli_distribution nonzero(density);
+    std::uniform_int_distribution<int> value(1, 2);
+
+    TernaryVector vec(dim);
+    for (int i = 0; i < dim; i++) {
+        if (nonzero(gen)) { vec.pushBack(i, value(gen)); }
+    }
+    return vec;
+}
+
+static void BM_VectorAdd(benchmark::State& state) {
+    std::mt19937 gen(42);
+    const int dim = state.range(0);
+    const TernaryVector a = randomVector(dim, 0.1, gen);
+    const TernaryVector b = randomVector(dim, 0.1, gen);
+
+    TernaryVector result(dim);
+    for (auto _ : state) {
+        a.add(b, 2, result);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * (a.size() + b.size()));
+}
+BENCHMARK(BM_VectorAdd)->RangeMultiplier(8)->Range(1<<10, 1<<20);
+
+static void BM_MatrixReduce(benchmark::State& state) {
+    const TernaryMatrix D = gen::randomFilteredMatrix<ternary>(state.range(0), 3, 42);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        TernaryMatrix R = D;
+        state.ResumeTiming();
+
+        R.reduce();
+        benchmark::DoNotOptimize(R);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_MatrixReduce)->RangeMultiplier(4)->Range(1<<8, 1<<14)->Complexity();
+
+static void BM_MatrixDecompose(benchmark::State& state) {
+    const TernaryMatrix D = gen::randomFilteredMatrix<ternary>(state.range(0), 3, 42);
+
+    for (auto _ : state) {
+        TernaryMatrix kernel, image;
+        D.decompose(kernel, image);
+        benchmark::DoNotOptimize(kernel);
+        benchmark::DoNotOptimize(image);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_MatrixDecompose)->RangeMultiplier(4)->Range(1<<8, 1<<14)->Complexity();
+
+static void BM_MatrixSolve(benchmark::State& state) {
+    // A has to be reduced and B has to be in its image
+    TernaryMatrix A = gen::randomFilteredMatrix<ternary>(state.range(0), 3, 42);
+    A.reduce(true);
+    const TernaryMatrix B = A * gen::randomFilteredMatrix<ternary>(A.cols(), 3, 43);
+
+    for (auto _ : state) {
+        TernaryMatrix X;
+        A.solve(B, X);
+        benchmark::DoNotOptimize(X);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_MatrixSolve)->RangeMultiplier(4)->Range(1<<8, 1<<14)->Complexity();
+
+static void BM_MatrixMultiply(benchmark::State& state) {
+    const TernaryMatrix A = gen::randomFilteredMatrix<ternary>(state.range(0), 3, 42);
+    const TernaryMatrix B = gen::randomFilteredMatrix<ternary>(state.range(0), 3, 43);
+
+    for (auto _ : state) {
+        TernaryMatrix C;
+        A.multiply(B, C);
+        benchmark::DoNotOptimize(C);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_MatrixMultiply)->RangeMultiplier(4)->Range(1<<6, 1<<10)->Complexity();
@@ -0,0 +1,84 @@
+#include "meb.h"
+#include "Miniball.h"
+#include "generators.h"
+
+#include "benchmark/benchmark.h"
+
+// random simplices with K vertices among n points, the indices go into the flat buffer
+template <int D, int K>
+static void randomSimplices(const int& n, std::vector<double>& coords, std::vector<int>& simplices) {
+    coords = gen::flatten(gen::uniformCloud(n, D, 42));
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> vertex(0, n-1);
+    simplices.resize(n*K);
+    for (int& v : simplices) { v = vertex(gen); }
+}
+
+template <int D, int K>
+static void BM_MiniballRadius(benchmark::State& state) {
+    using MB = Miniball::Miniball<Miniball::CoordAccessor<const double* const*, const double*>>;
+    const int n = state.range(0);
+    std::vector<double> coords;     std::vector<int> simplices;
+    randomSimplices<D,K>(n, coords, simplices);
+
+    std::vector<double> radii(n);
+    const double* points[K];
+    for (auto _ : state) {
+        for (int simplexN = 0; simplexN < n; simplexN++) {
+            for (int j = 0; j < K; j++) { points[j] = coords.data() + D*simplices[simplexN*K + j]; }
+            const MB mb(D, points, points + K);
+            radii[simplexN] = mb.squared_radius();
+        }
+        benchmark::DoNotOptimize(radii.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <int D, int K>
+static void BM_MebRadius(benchmark::State& state) {
+    const int n = state.range(0);
+    std::vector<double> coords;     std::vector<int> simplices;
+    randomSimplices<D,K>(n, coords, simplices);
+
+    std::vector<double> radii(n);
+    for (auto _ : state) {
+        meb::squaredRadii<D,K>(coords.data(), simplices.data(), n, radii.data());
+        benchmark::DoNotOptimize(radii.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <int D, int K>
+static void BM_FixedMiniballRadius(benchmark::State& state) {
+    const int n = state.range(0);
+    std::vector<double> coords;     std::vector<int> simplices;
+    randomSimplices<D,K>(n, coords, simplices);
+
+    std::vector<double> radii(n);
+    meb::Miniball<D> mb;
+    for (auto _ : state) {
+        mb.compute(coords.data(), simplices.data(), K, n, radii.data());
+        benchmark::DoNotOptimize(radii.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_TEMPLATE(BM_MiniballRadius, 2, 2)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_MebRadius, 2, 2)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_MiniballRadius, 2, 3)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_MebRadius, 2, 3)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_MiniballRadius, 3, 3)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_MebRadius, 3, 3)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_MiniballRadius, 3, 4)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_MebRadius, 3, 4)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_MiniballRadius, 5, 5)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_FixedMiniballRadius, 5, 5)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_MiniballRadius, 6, 7)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_FixedMiniballRadius, 6, 7)->Arg(1<<14);
+// the top simplices of the higher dimensions take a single solver call each
+BENCHMARK_TEMPLATE(BM_MebRadius, 4, 5)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_FixedMiniballRadius, 4, 5)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_MebRadius, 5, 6)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_FixedMiniballRadius, 5, 6)->Arg(1<<14);
+BENCHMARK_TEMPLATE(BM_MebRadius, 6, 7)->Arg(1<<14);
@@ -0,0 +1,175 @@
+#include <random>
+
+#include "topology.h"
+#include "toprep.h"
+#include "vineyard.h"
+#include "tstep.h"
+#include "generators.h"
+
+#include "benchmark/benchmark.h"
+
+using namespace top;
+
+// triangulated n x n grid, every simplex appears at the latest time of its vertices,
+// the simplices are inserted in random order (with duplicate faces) like a triangulation would
+static Complex<ts::tstep,int> gridComplex(const int& n, const unsigned& seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> time(0, 4*n);
+
+    std::vector<int> vertex_times(n*n);
+    for (int& t : vertex_times) { t = time(gen); }
+
+    const auto vertex = [&](const int& i, const int& j) { return i*n + j; };
+    const auto simplexTime = [&](const std::vector<int>& simp) {
+        int t = 0;
+        for (const int& v : simp) { t = std::max(t, vertex_times[v]); }
+        return t;
+    };
+
+    Complex<ts::tstep,int> C;
+    for (int i = 0; i+1 < n; i++) {
+        for (int j = 0; j+1 < n; j++) {
+            const std::vector<std::vector<int>> triangles = {
+                { vertex(i,j), vertex(i+1,j), vertex(i+1,j+1) },
+                { vertex(i,j), vertex(i,j+1), vertex(i+1,j+1) }
+            };
+            for (const std::vector<int>& tri : triangles) {
+                C.insert(Simplex<int>(tri), simplexTime(tri));
+                for (int k = 0; k < 3; k++) {
+                    const Simplex<int> edge = Simplex<int>(tri).erase(k);
+                    C.insert(edge, simplexTime({ edge[0], edge[1] }));
+                    C.insert(Simplex<int>(tri[k]), vertex_times[tri[k]]);
+                }
+            }
+        }
+    }
+    return C;
+}
+
+static void BM_ComplexFinalize(benchmark::State& state) {
+    const Complex<ts::tstep,int> C = gridComplex(state.range(0), 42);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Complex<ts::tstep,int> F = C;
+        state.ResumeTiming();
+
+        F.finalize();
+        benchmark::DoNotOptimize(F);
+    }
+    state.SetComplexityN(C.size());
+}
+BENCHMARK(BM_ComplexFinalize)->RangeMultiplier(2)->Range(16, 256)->Complexity();
+
+static void BM_Boundary(benchmark::State& state) {
+    Complex<ts::tstep,int> C = gridComplex(state.range(0), 42);
+    C.finalize();
+
+    for (auto _ : state) {
+        auto D = boundary<num::ternary,ts::tstep>(C);
+        benchmark::DoNotOptimize(D);
+    }
+    state.SetComplexityN(C.size());
+}
+BENCHMARK(BM_Boundary)->RangeMultiplier(2)->Range(16, 256)->Complexity();
+
+static void BM_Module(benchmark::State& state) {
+    Complex<ts::tstep,int> C = gridComplex(state.range(0), 42);
+    C.finalize();
+    const auto D = boundary<num::ternary,ts::tstep>(C);
+
+    for (auto _ : state) {
+        toprep::Module<num::ternary,ts::tstep> M(D);
+        benchmark::DoNotOptimize(M);
+    }
+    state.SetComplexityN(C.size());
+}
+BENCHMARK(BM_Module)->RangeMultiplier(2)->Range(8, 64)->Complexity();
+
+// sweeps the size of a 2D Rips complex, the radius shrinks with the number of
+// points so the average degree stays the same (about 50 simplices per point)
+static void BM_RipsComplex(benchmark::State& state) {
+    const int n = state.range(0);
+    const gen::PointCloud points = gen::uniformCloud(n, 2, 42);
+    const double radius = 2.0 / std::sqrt(n);
+
+    int simplices = 0;
+    for (auto _ : state) {
+        auto C = gen::ripsComplex(points, radius, 2);
+        C.finalize();
+        simplices = C.size();
+        benchmark::DoNotOptimize(C);
+    }
+    state.counters["simplices"] = simplices;
+    state.SetComplexityN(simplices);
+}
+BENCHMARK(BM_RipsComplex)->RangeMultiplier(8)->Range(1<<6, 1<<15)->Complexity();
+
+static void BM_RandomModule(benchmark::State& state) {
+    const int n = state.range(0);
+    const auto D = gen::randomBoundary<num::binary>(n, 8.0 / n, 2, n, 42);
+
+    for (auto _ : state) {
+        toprep::Module<num::binary,ts::tstep> M(D);
+        benchmark::DoNotOptimize(M);
+    }
+    state.counters["simplices"] = D.cols();
+    state.SetComplexityN(D.cols());
+}
+BENCHMARK(BM_RandomModule)->RangeMultiplier(4)->Range(1<<6, 1<<12)->Complexity();
+
+// the full Rips complex (up to the triangles) of 50 points in the plane, which are
+// moved back and forth by a gaussian jitter of range(0) * 1e-5
+struct Jitter {
+    top::Complex<ts::tstepdouble,int> C, moved;
+    std::vector<std::pair<int,ts::tstepdouble>> forth, back;
+
+    explicit Jitter(const double& sigma) {
+        gen::PointCloud points = gen::uniformCloud(50, 2, 42);
+        C = gen::ripsComplex(points, 10, 2);
+        C.finalize();
+
+        std::mt19937 gen(43);
+        std::normal_distribution<double> normal(0, sigma);
+        for (std::vector<double>& p : points) {
+            for (double& x : p) { x += normal(gen); }
+        }
+        moved = gen::ripsComplex(points, 10, 2);
+        moved.finalize();
+
+        for (int i = 0; i < C.size(); i++) {
+            forth.push_back({ C.getIndex(moved[i]), moved.getTime(i) });
+            back.push_back({ i, C.getTime(i) });
+        }
+    }
+};
+
+static void BM_VineyardUpdate(benchmark::State& state) {
+    const Jitter jitter(state.range(0) * 1e-5);
+    auto C = jitter.C;
+    toprep::Vineyard<num::binary,ts::tstepdouble> vineyard(C);
+
+    bool moved = false;
+    for (auto _ : state) {
+        vineyard.update(moved ? jitter.back : jitter.forth);
+        moved = !moved;
+    }
+    state.counters["transpositions"] = benchmark::Counter(vineyard.transpositionCount(), benchmark::Counter::kAvgIterations);
+    state.counters["rebuilds"] = benchmark::Counter(vineyard.rebuildCount(), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_VineyardUpdate)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+
+// the same steps with the barcode computed from scratch
+static void BM_VineyardRecompute(benchmark::State& state) {
+    Jitter jitter(state.range(0) * 1e-5);
+    const auto forth = top::boundary<num::binary>(jitter.moved);
+    const auto back = top::boundary<num::binary>(jitter.C);
+
+    bool moved = false;
+    std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>> barcode;
+    for (auto _ : state) {
+        toprep::Module<num::binary,ts::tstepdouble>(moved ? back : forth).getBarcode(barcode);
+        moved = !moved;
+    }
+}
+BENCHMARK(BM_VineyardRecompute)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
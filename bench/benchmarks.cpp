@@ -0,0 +1,9 @@
+#include "benchmark/benchmark.h"
+
+#include "bench-linalg.cpp"
+#include "bench-topology.cpp"
+#include "bench-geometry.cpp"
+#include "bench-meb.cpp"
+
+// run with --benchmark_out=<file> --benchmark_out_format=json to store the results
+BENCHMARK_MAIN();
@@ -0,0 +1,20 @@
+#include <limits>
+
+#include "bifiltration.h"
+
+namespace bifiltration {
+
+    double push(const Line& line, const ts::bistepdouble& grade) {
+        ASSERT(line.direction[0] >= 0 && line.direction[1] >= 0);
+        ASSERT(line.direction[0] > 0 || line.direction[1] > 0);
+
+        const double coords[2] = { grade.first(), grade.second() };
+        double t = -std::numeric_limits<double>::infinity();
+        for (int i = 0; i < 2; i++) {
+            const double diff = coords[i] - line.base[i];
+            if (line.direction[i] > 0) { t = std::max(t, diff / line.direction[i]); }
+            else if (diff > 0) { return std::numeric_limits<double>::infinity(); }
+        }
+        return t;
+    }
+}
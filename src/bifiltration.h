@@ -0,0 +1,43 @@
+#ifndef _BIFILTRATION_H
+#define _BIFILTRATION_H
+
+#include <vector>
+
+#include "topology.h"
+#include "toprep.h"
+#include "bistep.h"
+#include "parallel.h"
+
+/// Two parameter persistence through the fibered barcode: the bifiltration is
+/// restricted to lines of positive slope, each restriction is a 1-parameter
+/// filtration with an ordinary barcode.
+namespace bifiltration {
+
+    /// the line base + t*direction in the parameter plane, the direction has
+    /// nonnegative coordinates (not both zero)
+    struct Line {
+        double base[2];
+        double direction[2];
+    };
+
+    /// the parameter t at which the line enters the upper set of the grade (the first
+    /// point of the line which the grade precedes), infinity if it never does
+    double push(const Line& line, const ts::bistepdouble& grade);
+
+    /// the fibered barcode of a bifiltered complex, barcodes[i] is the barcode along
+    /// lines[i] (in the line parameter t, without the simplices the line never
+    /// reaches). The boundary is built once, every line only reorders its rows and
+    /// columns (see Map::permute) and is reduced, the lines are done in parallel.
+    template <typename number, typename indextype>
+    void fiberedBarcode(top::Complex<ts::bistepdouble,indextype>& C, const std::vector<Line>& lines,
+            std::vector<std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>>>& barcodes);
+
+    /// the same for the boundary of the complex (with the grades as its times)
+    template <typename number>
+    void fiberedBarcode(const toprep::Map<number,ts::bistepdouble>& boundry, const std::vector<Line>& lines,
+            std::vector<std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>>>& barcodes);
+}
+
+#include "bifiltration.hpp"
+
+#endif
@@ -0,0 +1,46 @@
+#include <numeric>
+#include <algorithm>
+
+namespace bifiltration {
+
+    template <typename number, typename indextype>
+    void fiberedBarcode(top::Complex<ts::bistepdouble,indextype>& C, const std::vector<Line>& lines,
+            std::vector<std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>>>& barcodes) {
+        fiberedBarcode(top::boundary<number>(C), lines, barcodes);
+    }
+
+    template <typename number>
+    void fiberedBarcode(const toprep::Map<number,ts::bistepdouble>& boundry, const std::vector<Line>& lines,
+            std::vector<std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>>>& barcodes) {
+        const int size = boundry.cols();
+        barcodes.assign(lines.size(), {});
+
+        parallel::forEach(lines.size(), [&](const int& lineN) {
+            std::vector<double> pushed(size);
+            for (int simplexN = 0; simplexN < size; simplexN++) {
+                pushed[simplexN] = push(lines[lineN], boundry.getColTime(simplexN));
+            }
+
+            // the order along the line, the ties keep the order of the complex so the
+            // faces stay before their cofaces
+            std::vector<int> order(size);
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(),
+                    [&](const int& a, const int& b) { return pushed[a] < pushed[b]; });
+
+            std::vector<ts::tstepdouble> times(size);
+            for (int i = 0; i < size; i++) { times[i] = pushed[order[i]]; }
+
+            std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>> barcode;
+            {
+                const toprep::Module<number,ts::tstepdouble> module(boundry.permute(order, times));
+                module.getBarcode(barcode);
+            }
+
+            std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>>& result = barcodes[lineN];
+            for (const std::pair<ts::tstepdouble,ts::tstepdouble>& bar : barcode) {
+                if (!bar.first.isInfinity()) { result.push_back(bar); }
+            }
+        });
+    }
+}
@@ -0,0 +1 @@
+#include "bistep.h"
@@ -0,0 +1,66 @@
+#ifndef _BISTEP_H
+#define _BISTEP_H
+
+#include "tstep.h"
+
+
+namespace ts {
+
+    /// a time step of a bifiltration, the grade (x,y) of two parameters (i.e. the
+    /// radius and a codensity). The grades are partially ordered by the product order
+    /// (see precedes), the comparison operators use the lexicographic order which
+    /// extends it, so a complex finalized with them is a filtration of the bifiltration
+    /// and its boundary carries the grades as the row and column times.
+    template <typename T, typename Policy = TimePolicy<T>>
+    class bistep {
+    private:
+        T x;
+        T y;
+
+    public:
+        using val_type = T;
+
+        static constexpr T INF = Policy::INF;
+        static constexpr T UNDEFINED = Policy::UNDEFINED;
+
+        /// default constructor (sets to undefined if called without an argument),
+        /// a single value is taken for both parameters
+        constexpr bistep(const T& t=UNDEFINED);
+        constexpr bistep(const T& x, const T& y);
+
+        constexpr T first() const { return x; }
+        constexpr T second() const { return y; }
+
+        constexpr bool isUndefined() const;
+        constexpr bool isInfinity() const;
+
+        /// the product order, both parameters are at most the ones of the other grade
+        constexpr bool precedes(const bistep&) const;
+        /// the smallest grade preceded by both (the coordinatewise maximum)
+        constexpr bistep join(const bistep&) const;
+
+        /// comparison operator (lexicographic)
+        constexpr bool operator ==(const bistep&) const;
+        constexpr bool operator !=(const bistep&) const;
+        constexpr bool operator <(const bistep&) const;
+        constexpr bool operator <=(const bistep&) const;
+
+        // by the product order
+        constexpr bool canMultiplyBy(const bistep&) const;
+        constexpr bool canAddBy(const bistep&) const;
+
+        constexpr bool canMultiplyTo(const bistep&) const;
+        constexpr bool canAddTo(const bistep&) const;
+    };
+
+    template <typename T, typename Policy>
+    std::ostream& operator <<(std::ostream& os, const bistep<T,Policy>& ts);
+
+    // type aliases
+    using bistepdouble = bistep<double>;
+
+}
+
+#include "bistep.hpp"
+
+#endif
@@ -0,0 +1,85 @@
+namespace ts {
+
+    template <typename T, typename Policy>
+    constexpr T bistep<T,Policy>::INF;
+    template <typename T, typename Policy>
+    constexpr T bistep<T,Policy>::UNDEFINED;
+
+    template <typename T, typename Policy>
+    constexpr bistep<T,Policy>::bistep(const T& t) : x(t), y(t) {}
+
+    template <typename T, typename Policy>
+    constexpr bistep<T,Policy>::bistep(const T& _x, const T& _y) : x(_x), y(_y) {}
+
+    template <typename T, typename Policy>
+    constexpr bool bistep<T,Policy>::isUndefined() const {
+        return Policy::isUndefined(x) || Policy::isUndefined(y);
+    }
+
+    template <typename T, typename Policy>
+    constexpr bool bistep<T,Policy>::isInfinity() const {
+        return x == INF || y == INF;
+    }
+
+    template <typename T, typename Policy>
+    constexpr bool bistep<T,Policy>::precedes(const bistep& other) const {
+        DEBUG_ASSERT(!isUndefined() && !other.isUndefined());
+        return x <= other.x && y <= other.y;
+    }
+
+    template <typename T, typename Policy>
+    constexpr bistep<T,Policy> bistep<T,Policy>::join(const bistep& other) const {
+        DEBUG_ASSERT(!isUndefined() && !other.isUndefined());
+        return bistep(x < other.x ? other.x : x, y < other.y ? other.y : y);
+    }
+
+
+    template <typename T, typename Policy>
+    constexpr bool bistep<T,Policy>::operator ==(const bistep& other) const {
+        return x == other.x && y == other.y;
+    }
+
+    template <typename T, typename Policy>
+    constexpr bool bistep<T,Policy>::operator !=(const bistep& other) const {
+        return !(*this == other);
+    }
+
+    template <typename T, typename Policy>
+    constexpr bool bistep<T,Policy>::operator <(const bistep& other) const {
+        DEBUG_ASSERT(!isUndefined() && !other.isUndefined());
+        return x < other.x || (x == other.x && y < other.y);
+    }
+
+    template <typename T, typename Policy>
+    constexpr bool bistep<T,Policy>::operator <=(const bistep& other) const {
+        DEBUG_ASSERT(!isUndefined() && !other.isUndefined());
+        return x < other.x || (x == other.x && y <= other.y);
+    }
+
+    template <typename T, typename Policy>
+    constexpr bool bistep<T,Policy>::canMultiplyBy(const bistep& other) const {
+        return other.precedes(*this);
+    }
+
+    template <typename T, typename Policy>
+    constexpr bool bistep<T,Policy>::canAddBy(const bistep& other) const {
+        return other.precedes(*this);
+    }
+
+    template <typename T, typename Policy>
+    constexpr bool bistep<T,Policy>::canMultiplyTo(const bistep& other) const {
+        return precedes(other);
+    }
+
+    template <typename T, typename Policy>
+    constexpr bool bistep<T,Policy>::canAddTo(const bistep& other) const {
+        return precedes(other);
+    }
+
+    template <typename T, typename Policy>
+    std::ostream& operator <<(std::ostream& os, const bistep<T,Policy>& ts) {
+        if (ts.isUndefined()) { os << "undefined"; }
+        else { os << "(" << timestep<T,Policy>(ts.first()) << "," << timestep<T,Policy>(ts.second()) << ")"; }
+        return os;
+    }
+}
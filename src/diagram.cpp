@@ -0,0 +1,486 @@
+#include <cmath>
+#include <set>
+#include <deque>
+#include <algorithm>
+#include <unordered_map>
+#include <boost/functional/hash.hpp>
+
+#include "diagram.h"
+
+namespace diagram {
+
+    namespace {
+        using Point = std::pair<double,double>;
+
+        constexpr double INF = std::numeric_limits<double>::infinity();
+
+        double distance(const Point& a, const Point& b) {
+            return std::max(std::abs(a.first - b.first), std::abs(a.second - b.second));
+        }
+
+        double diagonalDistance(const Point& a) {
+            return (a.second - a.first) / 2;
+        }
+
+        // splits the diagram into the finite points and the sorted births of the essential classes
+        void split(const Diagram& diagram, Diagram& finite, std::vector<double>& essential) {
+            for (const Point& point : diagram) {
+                if (std::isinf(point.second)) { essential.push_back(point.first); }
+                else { finite.push_back(point); }
+            }
+            std::sort(essential.begin(), essential.end());
+        }
+
+        // the points in a grid of cells of the given size, a query takes one of the points
+        // (or visits all the points) within the size of the given one, which are all in the
+        // neighboring cells
+        class Grid {
+        public:
+            Grid(const Diagram& points, const double& size):
+                    points(points), size(size > 0 ? size : 1) {
+                for (int pointN = 0; pointN < int(points.size()); pointN++) {
+                    cells[cell(points[pointN])].push_back(pointN);
+                }
+            }
+
+            /// removes and returns a point within the distance r of the query which is not
+            /// taken yet, -1 if there is none
+            int take(const Point& query, const double& r, std::vector<bool>& taken) {
+                const Cell center = cell(query);
+                for (long dx = -1; dx <= 1; dx++) {
+                    for (long dy = -1; dy <= 1; dy++) {
+                        const auto cell_ptr = cells.find({ center.first + dx, center.second + dy });
+                        if (cell_ptr == cells.end()) { continue; }
+
+                        std::vector<int>& bucket = cell_ptr->second;
+                        for (size_t i = 0; i < bucket.size(); ) {
+                            const int pointN = bucket[i];
+                            if (taken[pointN] || distance(points[pointN], query) <= r) {
+                                bucket[i] = bucket.back();
+                                bucket.pop_back();
+                                if (!taken[pointN]) {
+                                    taken[pointN] = true;
+                                    return pointN;
+                                }
+                            }
+                            else { i++; }
+                        }
+                    }
+                }
+                return -1;
+            }
+
+            /// calls visit with all the points within the distance r of the query,
+            /// r has to be at most the size of the cells
+            template <typename Visit>
+            void within(const Point& query, const double& r, const Visit& visit) const {
+                const Cell center = cell(query);
+                for (long dx = -1; dx <= 1; dx++) {
+                    for (long dy = -1; dy <= 1; dy++) {
+                        const auto cell_ptr = cells.find({ center.first + dx, center.second + dy });
+                        if (cell_ptr == cells.end()) { continue; }
+
+                        for (const int& pointN : cell_ptr->second) {
+                            if (distance(points[pointN], query) <= r) { visit(pointN); }
+                        }
+                    }
+                }
+            }
+
+        private:
+            using Cell = std::pair<long,long>;
+
+            Cell cell(const Point& point) const {
+                return { long(std::floor(point.first / size)), long(std::floor(point.second / size)) };
+            }
+
+            const Diagram& points;
+            const double size;
+            std::unordered_map<Cell,std::vector<int>,boost::hash<Cell>> cells;
+        };
+
+        // is there a matching of a and b (with the diagonal) with all the distances at most r,
+        // the bipartite graph has the points of a and the diagonal copies of b on the left
+        // side and the points of b and the diagonal copies of a on the right side. The
+        // matching starts from the given one (which has to be valid for r) and is left
+        // maximum for r, so a failed search can start the ones with larger r.
+        bool matchable(const Diagram& a, const Diagram& b, const double& r,
+                std::vector<int>& left_mate, std::vector<int>& right_mate) {
+            const int n = a.size(), m = b.size();
+            const int size = n + m;
+
+            // the left vertices are a (0..n) and b' (n..n+m), the right ones are b (0..m)
+            // and a' (m..m+n)
+            const auto match = [&](const int& u, const int& v) { left_mate[u] = v; right_mate[v] = u; };
+
+            // add the points near the diagonal matched to it
+            for (int i = 0; i < n; i++) {
+                if (left_mate[i] == -1 && right_mate[m + i] == -1 && diagonalDistance(a[i]) <= r) { match(i, m + i); }
+            }
+            for (int j = 0; j < m; j++) {
+                if (left_mate[n + j] == -1 && right_mate[j] == -1 && diagonalDistance(b[j]) <= r) { match(n + j, j); }
+            }
+
+            // every phase searches vertex disjoint augmenting paths from the free left
+            // vertices (depth first), a visited right vertex is not visited again in the
+            // phase, so the neighbors can be taken out of the grid
+            std::vector<bool> visited(size);
+            std::vector<int> path, targets;
+            while (true) {
+                Grid grid(b, r);
+                std::fill(visited.begin(), visited.end(), false);
+                int next_copy = m;      // the copies of a are all at distance zero from the copies of b
+
+                const auto neighbor = [&](const int& u) {
+                    if (u < n) {
+                        const int j = grid.take(a[u], r, visited);
+                        if (j != -1) { return j; }
+                        if (diagonalDistance(a[u]) <= r && !visited[m + u]) { visited[m + u] = true; return m + u; }
+                        return -1;
+                    }
+                    const int j = u - n;
+                    if (diagonalDistance(b[j]) <= r && !visited[j]) { visited[j] = true; return j; }
+                    while (next_copy < size && visited[next_copy]) { next_copy++; }
+                    if (next_copy == size) { return -1; }
+                    visited[next_copy] = true;
+                    return next_copy;
+                };
+
+                int found = 0, free_count = 0;
+                for (int start = 0; start < size; start++) {
+                    if (left_mate[start] != -1) { continue; }
+                    free_count++;
+
+                    path.assign(1, start);
+                    targets.clear();
+                    while (!path.empty()) {
+                        const int v = neighbor(path.back());
+                        if (v == -1) {
+                            path.pop_back();
+                            if (!targets.empty()) { targets.pop_back(); }
+                            continue;
+                        }
+                        targets.push_back(v);
+                        if (right_mate[v] == -1) {
+                            for (size_t k = 0; k < path.size(); k++) { match(path[k], targets[k]); }
+                            found++;
+                            break;
+                        }
+                        path.push_back(right_mate[v]);
+                    }
+                }
+                if (found == free_count) { return true; }
+                if (found == 0) { return false; }
+            }
+        }
+
+        double finiteBottleneck(const Diagram& a, const Diagram& b) {
+            // matching all the points to the diagonal is always possible
+            double hi = 0;
+            for (const Point& point : a) { hi = std::max(hi, diagonalDistance(point)); }
+            for (const Point& point : b) { hi = std::max(hi, diagonalDistance(point)); }
+            if (hi == 0) { return 0; }
+
+            // the maximum matching of the last failed search is valid for all the larger
+            // distances, so the next searches start from it
+            const int size = a.size() + b.size();
+            std::vector<int> lo_left(size, -1), lo_right(size, -1), left, right;
+            const auto matches = [&](const double& r) {
+                left = lo_left;
+                right = lo_right;
+                if (matchable(a, b, r, left, right)) { return true; }
+                lo_left.swap(left);
+                lo_right.swap(right);
+                return false;
+            };
+
+            // narrow the interval by bisection, the distance is in (lo,hi]
+            double lo = -1;
+            for (int iteration = 0; iteration < 40 && hi - std::max(lo, 0.0) > 1e-9 * hi; iteration++) {
+                const double mid = (std::max(lo, 0.0) + hi) / 2;
+                if (matches(mid)) { hi = mid; }
+                else { lo = mid; }
+            }
+
+            // the distance is one of the candidates in the interval
+            std::vector<double> candidates = { hi };
+            const auto candidate = [&](const double& d) {
+                if (lo < d && d <= hi) { candidates.push_back(d); }
+            };
+            for (const Point& point : a) { candidate(diagonalDistance(point)); }
+            for (const Point& point : b) { candidate(diagonalDistance(point)); }
+            // only the pairs within hi can be candidates
+            const Grid grid(b, hi);
+            for (const Point& point : a) {
+                grid.within(point, hi, [&](const int& j) { candidate(distance(point, b[j])); });
+            }
+            std::sort(candidates.begin(), candidates.end());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+            int first = 0, last = candidates.size() - 1;   // the last one is matchable
+            while (first < last) {
+                const int mid = (first + last) / 2;
+                if (matches(candidates[mid])) { last = mid; }
+                else { first = mid + 1; }
+            }
+            return candidates[last];
+        }
+
+        double power(const double& x, const double& p) {
+            return p == 1 ? x : p == 2 ? x*x : std::pow(x, p);
+        }
+
+        // the points in a grid of cells holding about four points each (at most n cells over
+        // their bounding box), the bids search the cells in rings around the bidder until
+        // the rest cannot beat its offers
+        class BidGrid {
+        public:
+            explicit BidGrid(const Diagram& points): points(points) {
+                const int n = points.size();
+                double min_x = INF, min_y = INF, max_x = -INF, max_y = -INF;
+                for (const Point& point : points) {
+                    min_x = std::min(min_x, point.first);   max_x = std::max(max_x, point.first);
+                    min_y = std::min(min_y, point.second);  max_y = std::max(max_y, point.second);
+                }
+                if (n == 0) { return; }
+                origin = { min_x, min_y };
+                const double width = max_x - min_x, height = max_y - min_y;
+                size = 2 * std::max(std::sqrt(width * height / n), std::max(width, height) / n);
+                if (!(size > 0)) { size = 1; }
+                columns = long(width / size) + 1;
+                rows = long(height / size) + 1;
+
+                // the points sorted by their cells, the cell c has them from starts[c] to starts[c+1]
+                std::vector<long> cell_of(n);
+                starts.assign(columns * rows + 1, 0);
+                for (int pointN = 0; pointN < n; pointN++) {
+                    const Cell c = cell(points[pointN]);
+                    cell_of[pointN] = std::min(c.first, columns - 1) * rows + std::min(c.second, rows - 1);
+                    starts[cell_of[pointN] + 1]++;
+                }
+                for (size_t c = 1; c < starts.size(); c++) { starts[c] += starts[c-1]; }
+                order.resize(n);
+                std::vector<int> filled(starts.begin(), starts.end() - 1);
+                for (int pointN = 0; pointN < n; pointN++) { order[filled[cell_of[pointN]]++] = pointN; }
+            }
+
+            /// offers the points to offer(point, cost) by the rings of the cells around the
+            /// query, until the costs of the ring (plus the smallest price) are at least
+            /// bound(), returns false if the cells are too sparse for it (the caller should
+            /// offer all the points instead)
+            template <typename Offer, typename Bound>
+            bool search(const Point& query, const double& p, const double& min_price,
+                    const Offer& offer, const Bound& bound) const {
+                if (order.empty()) { return true; }
+                const Cell center = cell(query);
+                const auto visit = [&](const long& x, const long& y) {
+                    const long c = x * rows + y;
+                    for (int i = starts[c]; i < starts[c+1]; i++) {
+                        offer(order[i], power(distance(points[order[i]], query), p));
+                    }
+                };
+
+                long visited = 0;
+                for (long k = 0; ; k++) {
+                    // the ring is the cells with the coordinates center -+ k (in the grid)
+                    const long left = center.first - k, right = center.first + k;
+                    const long bottom = center.second - k, top = center.second + k;
+                    // the previous rings cover the grid
+                    if (left < 0 && bottom < 0 && right >= columns && top >= rows) { return true; }
+                    // a point in the ring is at least k-1 cells away
+                    if (k > 0 && power((k-1) * size, p) + min_price >= bound()) { return true; }
+
+                    const long x_first = std::max(left, 0L), x_last = std::min(right, columns - 1);
+                    const long y_first = std::max(bottom + 1, 0L), y_last = std::min(top - 1, rows - 1);
+                    for (long x = x_first; x <= x_last; x++) {
+                        if (bottom >= 0 && bottom < rows) { visit(x, bottom); visited++; }
+                        if (k > 0 && top >= 0 && top < rows) { visit(x, top); visited++; }
+                    }
+                    for (long y = y_first; y <= y_last; y++) {
+                        if (left >= 0 && left < columns) { visit(left, y); visited++; }
+                        if (k > 0 && right >= 0 && right < columns) { visit(right, y); visited++; }
+                    }
+                    if (visited > long(order.size())) { return false; }
+                }
+            }
+
+        private:
+            using Cell = std::pair<long,long>;
+
+            Cell cell(const Point& point) const {
+                return { long(std::floor((point.first - origin.first) / size)),
+                         long(std::floor((point.second - origin.second) / size)) };
+            }
+
+            const Diagram& points;
+            Point origin;
+            double size = 1;
+            long columns = 0, rows = 0;
+            std::vector<int> starts, order;
+        };
+
+        // the auction algorithm for the p-th powers of the distances, the bidders are
+        // the points of a and the diagonal copies of b, the objects the points of b and
+        // the diagonal copies of a. The costs are computed when they are needed, the
+        // points of a only look at the nearby points of b (see BidGrid).
+        double finiteWasserstein(const Diagram& a, const Diagram& b, const double& p, const double& relative_error) {
+            const int n = a.size(), m = b.size();
+            const int size = n + m;
+            if (size == 0) { return 0; }
+
+            // the largest cost bounds the differences of the values
+            std::vector<double> a_diagonal(n), b_diagonal(m);
+            double max_cost = 0;
+            double min_x = INF, min_y = INF, max_x = -INF, max_y = -INF;
+            for (int i = 0; i < n; i++) {
+                a_diagonal[i] = power(diagonalDistance(a[i]), p);
+                max_cost = std::max(max_cost, a_diagonal[i]);
+                min_x = std::min(min_x, a[i].first);    max_x = std::max(max_x, a[i].first);
+                min_y = std::min(min_y, a[i].second);   max_y = std::max(max_y, a[i].second);
+            }
+            for (int j = 0; j < m; j++) {
+                b_diagonal[j] = power(diagonalDistance(b[j]), p);
+                max_cost = std::max(max_cost, b_diagonal[j]);
+                min_x = std::min(min_x, b[j].first);    max_x = std::max(max_x, b[j].first);
+                min_y = std::min(min_y, b[j].second);   max_y = std::max(max_y, b[j].second);
+            }
+            if (n > 0 && m > 0) { max_cost = std::max(max_cost, power(std::max(max_x - min_x, max_y - min_y), p)); }
+            if (max_cost == 0) { return 0; }
+
+            const BidGrid grid(b);
+            std::vector<double> prices(size, 0);
+            // the objects by their prices: the points of b (for the lower bound of the
+            // bids) and the diagonal copies of a (they cost nothing to all the copies of b)
+            std::set<std::pair<double,int>> point_prices, copy_prices;
+            for (int j = 0; j < m; j++) { point_prices.insert({ 0, j }); }
+            for (int i = 0; i < n; i++) { copy_prices.insert({ 0, m + i }); }
+            const auto raise = [&](const int& v, const double& price) {
+                std::set<std::pair<double,int>>& ordered = v < m ? point_prices : copy_prices;
+                ordered.erase({ prices[v], v });
+                ordered.insert({ price, v });
+                prices[v] = price;
+            };
+
+            std::vector<int> owners(size), objects(size);
+            double total = 0;
+            for (double eps = max_cost / 4; ; eps /= 5) {
+                std::fill(owners.begin(), owners.end(), -1);
+                std::fill(objects.begin(), objects.end(), -1);
+                std::deque<int> bidders;
+                for (int u = 0; u < size; u++) { bidders.push_back(u); }
+
+                while (!bidders.empty()) {
+                    const int u = bidders.front();  bidders.pop_front();
+
+                    // the best and the second best value (minus the cost and the price)
+                    int best = -1;
+                    double best_value = -INF, second_value = -INF;
+                    const auto offer = [&](const int& v, const double& cost) {
+                        const double value = -cost - prices[v];
+                        if (value > best_value) {
+                            second_value = best_value;
+                            best_value = value;
+                            best = v;
+                        }
+                        else if (value > second_value) { second_value = value; }
+                    };
+
+                    if (u < n) {
+                        offer(m + u, a_diagonal[u]);
+                        const double min_price = m > 0 ? point_prices.begin()->first : 0;
+                        if (!grid.search(a[u], p, min_price, offer, [&]() { return -second_value; })) {
+                            best = -1;
+                            best_value = second_value = -INF;
+                            offer(m + u, a_diagonal[u]);
+                            for (int j = 0; j < m; j++) { offer(j, power(distance(a[u], b[j]), p)); }
+                        }
+                    }
+                    else {
+                        offer(u - n, b_diagonal[u - n]);
+                        auto copy = copy_prices.begin();
+                        for (int k = 0; k < 2 && copy != copy_prices.end(); k++, ++copy) { offer(copy->second, 0); }
+                    }
+
+                    // a single option can be raised as much as any other one
+                    if (second_value == -INF) { second_value = best_value - max_cost; }
+                    raise(best, prices[best] + best_value - second_value + eps);
+
+                    if (owners[best] != -1) {
+                        objects[owners[best]] = -1;
+                        bidders.push_back(owners[best]);
+                    }
+                    owners[best] = u;
+                    objects[u] = best;
+                }
+
+                total = 0;
+                for (int u = 0; u < size; u++) {
+                    const int v = objects[u];
+                    if (u < n) { total += v < m ? power(distance(a[u], b[v]), p) : a_diagonal[u]; }
+                    else if (v < m) { total += b_diagonal[v]; }
+                }
+
+                // the assignment is within size*eps of the optimum
+                if (size * eps <= relative_error * (total - size * eps) || eps < 1e-12 * max_cost) { break; }
+            }
+            return total;
+        }
+    }
+
+    double bottleneck(const Diagram& a, const Diagram& b) {
+        Diagram a_finite, b_finite;
+        std::vector<double> a_essential, b_essential;
+        split(a, a_finite, a_essential);
+        split(b, b_finite, b_essential);
+        if (a_essential.size() != b_essential.size()) { return INF; }
+
+        double result = finiteBottleneck(a_finite, b_finite);
+        for (size_t i = 0; i < a_essential.size(); i++) {
+            result = std::max(result, std::abs(a_essential[i] - b_essential[i]));
+        }
+        return result;
+    }
+
+    double wasserstein(const Diagram& a, const Diagram& b, const double& p, const double& relative_error) {
+        ASSERT(p >= 1);
+        Diagram a_finite, b_finite;
+        std::vector<double> a_essential, b_essential;
+        split(a, a_finite, a_essential);
+        split(b, b_finite, b_essential);
+        if (a_essential.size() != b_essential.size()) { return INF; }
+
+        // the sorted order matches the essential classes optimally
+        double result = finiteWasserstein(a_finite, b_finite, p, relative_error);
+        for (size_t i = 0; i < a_essential.size(); i++) {
+            result += std::pow(std::abs(a_essential[i] - b_essential[i]), p);
+        }
+        return std::pow(result, 1 / p);
+    }
+
+    namespace {
+        template <typename Distance>
+        void distanceMatrix(const std::vector<Diagram>& diagrams, const Distance& dist, std::vector<double>& distances) {
+            const int n = diagrams.size();
+            distances.assign(size_t(n) * n, 0);
+
+            std::vector<std::pair<int,int>> pairs;
+            for (int i = 0; i < n; i++) {
+                for (int j = i+1; j < n; j++) { pairs.push_back({ i, j }); }
+            }
+            parallel::forEach(pairs.size(), [&](const int& pairN) {
+                const int i = pairs[pairN].first, j = pairs[pairN].second;
+                distances[size_t(i)*n + j] = distances[size_t(j)*n + i] = dist(diagrams[i], diagrams[j]);
+            });
+        }
+    }
+
+    void bottleneckMatrix(const std::vector<Diagram>& diagrams, std::vector<double>& distances) {
+        distanceMatrix(diagrams, bottleneck, distances);
+    }
+
+    void wassersteinMatrix(const std::vector<Diagram>& diagrams, const double& p, std::vector<double>& distances,
+            const double& relative_error) {
+        distanceMatrix(diagrams, [&](const Diagram& a, const Diagram& b) { return wasserstein(a, b, p, relative_error); },
+                distances);
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef _DIAGRAM_H
+#define _DIAGRAM_H
+
+#include <limits>
+#include <vector>
+#include <utility>
+
+#include "except.h"
+#include "parallel.h"
+
+/// Distances between persistence diagrams. The ground distance of two points is
+/// the L-infinity distance, a point can also be matched to the diagonal (at half
+/// its persistence) and the points at infinity are matched among themselves.
+namespace diagram {
+
+    /// the (birth, death) points of a barcode in one dimension, the death of an
+    /// essential class is infinite
+    using Diagram = std::vector<std::pair<double,double>>;
+
+    /// the diagram of the bars, the bars of zero length are left out
+    template <typename timeunit>
+    Diagram fromBarcode(const std::vector<std::pair<timeunit,timeunit>>& barcode);
+
+    /// the bottleneck distance (exact), infinite if the diagrams have a different
+    /// number of essential classes. The matchings are found on the graphs of the
+    /// pairs within a distance, the neighbors are searched in a grid of that size.
+    double bottleneck(const Diagram& a, const Diagram& b);
+
+    /// the p-Wasserstein distance, computed by the auction algorithm with epsilon
+    /// scaling until it is within the relative error of the optimum
+    double wasserstein(const Diagram& a, const Diagram& b, const double& p, const double& relative_error=0.01);
+
+    /// the distances of all the pairs of diagrams, computed in parallel, distances[i*n + j]
+    /// is the distance of the i-th and the j-th diagram
+    void bottleneckMatrix(const std::vector<Diagram>& diagrams, std::vector<double>& distances);
+    void wassersteinMatrix(const std::vector<Diagram>& diagrams, const double& p, std::vector<double>& distances,
+            const double& relative_error=0.01);
+}
+
+#include "diagram.hpp"
+
+#endif
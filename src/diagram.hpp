@@ -0,0 +1,15 @@
+namespace diagram {
+
+    template <typename timeunit>
+    Diagram fromBarcode(const std::vector<std::pair<timeunit,timeunit>>& barcode) {
+        Diagram result;
+        result.reserve(barcode.size());
+        for (const std::pair<timeunit,timeunit>& bar : barcode) {
+            if (bar.first == bar.second) { continue; }
+
+            const double death = bar.second.isInfinity() ? std::numeric_limits<double>::infinity() : double(bar.second.step());
+            result.push_back({ double(bar.first.step()), death });
+        }
+        return result;
+    }
+}
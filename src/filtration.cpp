@@ -0,0 +1,18 @@
+#include "filtration.h"
+
+namespace filtration {
+
+    void fromRanks(const std::vector<std::pair<ts::tstep,ts::tstep>>& ranks, const std::vector<double>& values,
+            const Value& value, std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>>& barcode) {
+        const std::vector<ts::tstepdouble> times(values.begin(), values.end());
+        toprep::unrank(ranks, times, barcode);
+        if (value == Value::SquaredRadius) { toRadii(barcode); }
+    }
+
+    void toRadii(std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>>& barcode) {
+        for (std::pair<ts::tstepdouble,ts::tstepdouble>& bar : barcode) {
+            bar.first = std::sqrt(bar.first.step());
+            bar.second = std::sqrt(bar.second.step());
+        }
+    }
+}
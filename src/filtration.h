@@ -0,0 +1,61 @@
+#ifndef _FILTRATION_H
+#define _FILTRATION_H
+
+#include <vector>
+
+#include "topology.h"
+#include "tstep.h"
+#include "tstepdouble.h"
+#include "meb.h"
+#include "parallel.h"
+
+/// Filtrations of the simplicial complexes spanned by the cells of a Delaunay
+/// triangulation. The points are given in an N x D coordinate buffer and the
+/// cells by the indices of their vertices.
+namespace filtration {
+
+    /// the filtration values stored as the times of the simplices. The squared radii
+    /// are in the same order as the radii, so the barcode is the same up to the
+    /// square roots (see toRadii), which are then taken only for its endpoints.
+    enum class Value { Radius, SquaredRadius };
+
+    /// the Cech filtration: a simplex appears at the radius of its smallest enclosing
+    /// ball. faces[k] holds the simplices with k+1 vertices, as k+1 consecutive
+    /// indices each. The dimensions are done in increasing order and the radii of
+    /// one dimension in parallel (see parallel::forEach), every task fills a fragment
+    /// of the complex and the fragments are merged. A simplex is raised to the values
+    /// of its facets (where the rounding put it below them), so the values are
+    /// monotone under faces.
+    template <int D>
+    top::Complex<ts::tstepdouble,int> cechComplex(const double* coords, const std::vector<std::vector<int>>& faces,
+            const Value& value = Value::Radius);
+
+    /// the alpha filtration: a simplex appears at the radius of its smallest empty
+    /// circumsphere. A simplex which is not Gabriel (a vertex of one of its cofacets
+    /// lies inside its smallest circumsphere) is attached and inherits the smallest
+    /// value of its cofacets. The values are computed in a single pass from the top
+    /// cells down, so they are monotone under faces.
+    template <int D>
+    top::Complex<ts::tstepdouble,int> alphaComplex(const double* coords, const std::vector<std::vector<int>>& cells,
+            const Value& value = Value::Radius);
+
+    /// replaces the times of C by their ranks among its distinct times, values[rank]
+    /// is the time of the rank (the values are sorted in a single pass). The ranked
+    /// complex has the same filtration order, so its barcode (computed with the
+    /// integer ts::tstep) is the barcode of C up to the translation by fromRanks.
+    template <typename indextype>
+    top::Complex<ts::tstep,indextype> rankComplex(const top::Complex<ts::tstepdouble,indextype>& C,
+            std::vector<double>& values);
+
+    /// translates a barcode of a ranked complex to the values of the ranks, the
+    /// infinite bars stay infinite. With the squared radii the radii are reported.
+    void fromRanks(const std::vector<std::pair<ts::tstep,ts::tstep>>& ranks, const std::vector<double>& values,
+            const Value& value, std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>>& barcode);
+
+    /// takes the square roots of the endpoints of a barcode of squared radii
+    void toRadii(std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>>& barcode);
+}
+
+#include "filtration.hpp"
+
+#endif
@@ -0,0 +1,225 @@
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <unordered_map>
+#include <boost/functional/hash.hpp>
+
+namespace filtration {
+
+    namespace detail {
+        // the number of simplices a task of cechComplex gets at least
+        constexpr int CHUNK = 2048;
+
+        // squared radii of count simplices with k vertices each
+        template <int D>
+        void squaredRadii(const double* coords, const int* simplices, const int& k, const int& count, double* out) {
+            switch (k) {
+                case 1: std::fill(out, out + count, 0.0); return;
+                case 2: meb::squaredRadii<D,2>(coords, simplices, count, out); return;
+                case 3: meb::squaredRadii<D,3>(coords, simplices, count, out); return;
+                case 4: meb::squaredRadii<D,4>(coords, simplices, count, out); return;
+            }
+
+            const double* points[D+1];
+            for (int simplexN = 0; simplexN < count; simplexN++) {
+                for (int j = 0; j < k; j++) { points[j] = coords + D*simplices[simplexN*k + j]; }
+                out[simplexN] = meb::squaredRadius<D>(points, k);
+            }
+        }
+
+        // the values of the simplices of one dimension by their sorted vertices, in an
+        // open addressing table over a flat vertex buffer (no allocation per simplex)
+        class ValueTable {
+        public:
+            /// the simplices with k vertices each (in any order) and their values
+            void assign(const int* simplices, const int& k, const int& count, const double* values) {
+                this->k = k;
+                vertices.assign(simplices, simplices + size_t(count) * k);
+                this->values.assign(values, values + count);
+                int capacity = 1;
+                while (capacity < 2 * count) { capacity *= 2; }
+                slots.assign(capacity, -1);
+
+                for (int simplexN = 0; simplexN < count; simplexN++) {
+                    int* simplex = vertices.data() + size_t(simplexN) * k;
+                    std::sort(simplex, simplex + k);
+                    size_t slot = boost::hash_range(simplex, simplex + k) & (slots.size() - 1);
+                    while (slots[slot] != -1) { slot = (slot + 1) & (slots.size() - 1); }
+                    slots[slot] = simplexN;
+                }
+            }
+
+            void clear() { vertices.clear(); values.clear(); slots.clear(); }
+            bool empty() const { return slots.empty(); }
+
+            /// the value of the sorted simplex, the pointer is null if it is not in the table
+            const double* find(const int* simplex) const {
+                size_t slot = boost::hash_range(simplex, simplex + k) & (slots.size() - 1);
+                while (slots[slot] != -1) {
+                    const int* entry = vertices.data() + size_t(slots[slot]) * k;
+                    if (std::equal(simplex, simplex + k, entry)) { return &values[slots[slot]]; }
+                    slot = (slot + 1) & (slots.size() - 1);
+                }
+                return nullptr;
+            }
+
+        private:
+            int k = 0;
+            std::vector<int> vertices;
+            std::vector<double> values;
+            std::vector<int> slots;
+        };
+
+        struct Face {
+            double value = std::numeric_limits<double>::infinity();    ///< smallest squared value of the cofaces
+            bool attached = false;  ///< a vertex of a coface is inside the smallest circumsphere
+        };
+    }
+
+    template <int D>
+    top::Complex<ts::tstepdouble,int> cechComplex(const double* coords, const std::vector<std::vector<int>>& faces,
+            const Value& value) {
+        // the squared radii of the previous dimension
+        detail::ValueTable facet_values;
+        std::vector<double> sq_radii;
+
+        STATS_PHASE(Miniball);
+        top::Complex<ts::tstepdouble,int> C;
+        // the dimensions in increasing order, the tasks are chunks of the simplices of one dimension
+        for (size_t dim = 0; dim < faces.size(); dim++) {
+            const int k = dim + 1;
+            const int count = faces[dim].size() / k;
+            const int chunk_count = parallel::chunkCount(count, detail::CHUNK);
+            const int per_chunk = (count + chunk_count - 1) / chunk_count;
+
+            sq_radii.assign(count, 0);
+            std::vector<top::Complex<ts::tstepdouble,int>> fragments(chunk_count);
+            parallel::forEach(chunk_count, [&](const int& chunkN) {
+                const int begin = chunkN * per_chunk, end = std::min(count, begin + per_chunk);
+                if (begin >= end) { return; }
+                const int* simplices = faces[dim].data() + begin * k;
+                detail::squaredRadii<D>(coords, simplices, k, end - begin, sq_radii.data() + begin);
+
+                std::vector<int> simplex(k), facet(k-1);
+                for (int simplexN = begin; simplexN < end; simplexN++) {
+                    std::copy(faces[dim].data() + simplexN*k, faces[dim].data() + (simplexN+1)*k, simplex.begin());
+                    double& sq_radius = sq_radii[simplexN];
+
+                    // the kernels of the edges and the triangles are never below their faces,
+                    // the larger simplices can round below them and take the values of their facets
+                    if (!facet_values.empty()) {
+                        std::sort(simplex.begin(), simplex.end());
+                        for (int i = 0; i < k; i++) {
+                            std::copy(simplex.begin(), simplex.begin() + i, facet.begin());
+                            std::copy(simplex.begin() + i + 1, simplex.end(), facet.begin() + i);
+                            const double* facet_value = facet_values.find(facet.data());
+                            if (facet_value != nullptr) { sq_radius = std::max(sq_radius, *facet_value); }
+                        }
+                    }
+                    fragments[chunkN].insert(top::Simplex<int>(simplex),
+                            value == Value::Radius ? std::sqrt(sq_radius) : sq_radius);
+                }
+            });
+
+            for (top::Complex<ts::tstepdouble,int>& fragment : fragments) {
+                C.merge(std::move(fragment));
+            }
+
+            // the values of the facets of the next dimension, if it needs them
+            facet_values.clear();
+            if (k >= 3 && dim+1 < faces.size() && !faces[dim+1].empty()) {
+                facet_values.assign(faces[dim].data(), k, count, sq_radii.data());
+            }
+        }
+        return C;
+    }
+
+    template <int D>
+    top::Complex<ts::tstepdouble,int> alphaComplex(const double* coords, const std::vector<std::vector<int>>& cells,
+            const Value& value) {
+        // the faces of each dimension by their sorted vertex indices
+        using FaceMap = std::unordered_map<std::vector<int>,detail::Face,boost::hash<std::vector<int>>>;
+
+        int top_dim = -1;
+        for (const std::vector<int>& cell : cells) { top_dim = std::max(top_dim, int(cell.size()) - 1); }
+        ASSERT(top_dim <= D);
+
+        top::Complex<ts::tstepdouble,int> C;
+        if (top_dim < 0) { return C; }
+
+        std::vector<FaceMap> faces(top_dim+1);
+        for (const std::vector<int>& cell : cells) {
+            std::vector<int> simplex = cell;
+            std::sort(simplex.begin(), simplex.end());
+            faces[simplex.size()-1].insert({ simplex, detail::Face() });
+        }
+
+        const double* points[D+1];
+        double center[D];
+        const auto circumsphere = [&](const std::vector<int>& simplex) {
+            for (size_t i = 0; i < simplex.size(); i++) { points[i] = coords + D*simplex[i]; }
+            return meb::circumsphere<D>(points, simplex.size(), center);
+        };
+
+        // all the cofaces of a face are done before it, an attached face takes the
+        // smallest value of its cofaces and the others their circumsphere
+        std::vector<int> facet;
+        for (int dim = top_dim; dim >= 0; dim--) {
+            for (auto& entry : faces[dim]) {
+                const std::vector<int>& simplex = entry.first;
+                detail::Face& face = entry.second;
+                if (!face.attached) { face.value = circumsphere(simplex); }
+                if (dim == 0) { continue; }
+
+                for (int i = 0; i <= dim; i++) {
+                    facet = simplex;
+                    facet.erase(facet.begin() + i);
+
+                    auto facet_ptr = faces[dim-1].find(facet);
+                    if (facet_ptr == faces[dim-1].end()) {
+                        facet_ptr = faces[dim-1].insert({ facet, detail::Face() }).first;
+                    }
+
+                    detail::Face& facet_face = facet_ptr->second;
+                    facet_face.value = std::min(facet_face.value, face.value);
+                    if (!facet_face.attached) {
+                        // the opposite vertex is inside the smallest circumsphere of the facet
+                        const double sq_radius = circumsphere(facet);
+                        facet_face.attached = meb::detail::sqDist<D>(center, coords + D*simplex[i]) < sq_radius;
+                    }
+                }
+            }
+        }
+
+        for (int dim = 0; dim <= top_dim; dim++) {
+            for (const auto& entry : faces[dim]) {
+                const double sq_radius = entry.second.value;
+                C.insert(top::Simplex<int>(entry.first), value == Value::Radius ? std::sqrt(sq_radius) : sq_radius);
+            }
+        }
+        return C;
+    }
+
+    template <typename indextype>
+    top::Complex<ts::tstep,indextype> rankComplex(const top::Complex<ts::tstepdouble,indextype>& C,
+            std::vector<double>& values) {
+        const int size = C.size();
+
+        values.resize(size);
+        for (int simplexN = 0; simplexN < size; simplexN++) {
+            DEBUG_ASSERT(!std::isnan(C.getTime(simplexN).step()));
+            values[simplexN] = C.getTime(simplexN).step();
+        }
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        ASSERT(values.size() < size_t(ts::tstep::UNDEFINED));
+
+        top::Complex<ts::tstep,indextype> R;
+        for (int simplexN = 0; simplexN < size; simplexN++) {
+            const double time = C.getTime(simplexN).step();
+            const int rank = std::lower_bound(values.begin(), values.end(), time) - values.begin();
+            R.insert(C[simplexN], rank);
+        }
+        return R;
+    }
+}
@@ -0,0 +1,271 @@
+#include <cmath>
+#include <numeric>
+#include <iterator>
+#include <unordered_map>
+#include <boost/functional/hash.hpp>
+
+#include "generators.h"
+#include "Miniball.h"
+
+namespace gen {
+
+    namespace {
+        using PointIterator = const double* const*;
+        using CoordIterator = const double*;
+        using MB = Miniball::Miniball<Miniball::CoordAccessor<PointIterator, CoordIterator>>;
+
+        // adjacency lists which only hold the neighbors with a larger index (sorted)
+        using UpperGraph = std::vector<std::vector<int>>;
+
+        struct CellHash {
+            std::size_t operator()(const std::vector<long>& cell) const {
+                return boost::hash_range(cell.begin(), cell.end());
+            }
+        };
+
+        double squaredDistance(const std::vector<double>& a, const std::vector<double>& b) {
+            double dist = 0;
+            for (size_t i = 0; i < a.size(); i++) {
+                const double diff = a[i] - b[i];
+                dist += diff*diff;
+            }
+            return dist;
+        }
+
+        // connects all the points within the distance, the points are bucketed into
+        // a grid with cells of the same size so only the neighboring cells are checked
+        void neighborGraph(const PointCloud& points, const double& dist, UpperGraph& upper) {
+            const int n = points.size();
+            upper.assign(n, std::vector<int>());
+            if (n == 0 || dist <= 0) { return; }
+
+            const int dim = points[0].size();
+            const double sq_dist = dist*dist;
+
+            std::unordered_map<std::vector<long>, std::vector<int>, CellHash> grid;
+            std::vector<long> cell(dim);
+            for (int pointN = 0; pointN < n; pointN++) {
+                for (int i = 0; i < dim; i++) { cell[i] = std::floor(points[pointN][i] / dist); }
+                grid[cell].push_back(pointN);
+            }
+
+            std::vector<long> neighbor(dim);
+            for (const auto& bucket : grid) {
+                // go through all the offsets in {-1,0,1}^dim
+                std::vector<int> offset(dim, -1);
+                while (true) {
+                    for (int i = 0; i < dim; i++) { neighbor[i] = bucket.first[i] + offset[i]; }
+
+                    const auto neighbor_ptr = grid.find(neighbor);
+                    if (neighbor_ptr != grid.end()) {
+                        for (const int& a : bucket.second) {
+                            for (const int& b : neighbor_ptr->second) {
+                                if (a < b && squaredDistance(points[a], points[b]) <= sq_dist) {
+                                    upper[a].push_back(b);
+                                }
+                            }
+                        }
+                    }
+
+                    int i = 0;
+                    while (i < dim && offset[i] == 1) { offset[i++] = -1; }
+                    if (i == dim) { break; }
+                    ++offset[i];
+                }
+            }
+
+            for (std::vector<int>& neighbors : upper) {
+                std::sort(neighbors.begin(), neighbors.end());
+            }
+        }
+
+        // extends the clique by each of the candidates (the common neighbors of the clique),
+        // value returns the time of the extended simplex or a negative number if it
+        // (and all its cofaces) should be skipped
+        template <typename timeunit, typename Value>
+        void expandCliques(std::vector<int>& clique, const std::vector<int>& candidates, const double& time,
+                const UpperGraph& upper, const int& max_dim, const Value& value,
+                top::Complex<timeunit,int>& C) {
+            std::vector<int> next;
+            for (const int& vertex : candidates) {
+                const double vertex_time = value(clique, time, vertex);
+                if (vertex_time < 0) { continue; }
+
+                clique.push_back(vertex);
+                C.insert(top::Simplex<int>(clique), static_cast<typename timeunit::val_type>(vertex_time));
+
+                if (int(clique.size()) - 1 < max_dim) {
+                    next.clear();
+                    std::set_intersection(candidates.begin(), candidates.end(),
+                            upper[vertex].begin(), upper[vertex].end(), std::back_inserter(next));
+                    expandCliques(clique, next, vertex_time, upper, max_dim, value, C);
+                }
+                clique.pop_back();
+            }
+        }
+
+        template <typename timeunit, typename Value>
+        top::Complex<timeunit,int> cliqueComplex(const UpperGraph& upper, const int& max_dim, const Value& value) {
+            top::Complex<timeunit,int> C;
+            std::vector<int> clique;
+            for (int vertex = 0; vertex < int(upper.size()); vertex++) {
+                C.insert(top::Simplex<int>(vertex), 0);
+                if (max_dim > 0) {
+                    clique.assign(1, vertex);
+                    expandCliques(clique, upper[vertex], 0, upper, max_dim, value, C);
+                }
+            }
+            return C;
+        }
+    }
+
+    PointCloud uniformCloud(const int& n, const int& dim, const unsigned& seed, const double& side) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> coord(0, side);
+
+        PointCloud points(n, std::vector<double>(dim));
+        for (std::vector<double>& p : points) {
+            for (double& x : p) { x = coord(gen); }
+        }
+        return points;
+    }
+
+    PointCloud gaussianMixture(const int& n, const int& dim, const int& components,
+            const double& sigma, const unsigned& seed) {
+        ASSERT(components > 0);
+
+        std::mt19937 gen(seed);
+        const PointCloud centers = uniformCloud(components, dim, gen());
+        std::uniform_int_distribution<int> component(0, components-1);
+        std::normal_distribution<double> noise(0, sigma);
+
+        PointCloud points(n, std::vector<double>(dim));
+        for (std::vector<double>& p : points) {
+            const std::vector<double>& center = centers[component(gen)];
+            for (int i = 0; i < dim; i++) { p[i] = center[i] + noise(gen); }
+        }
+        return points;
+    }
+
+    PointCloud sphereCloud(const int& n, const int& dim, const double& noise, const unsigned& seed) {
+        std::mt19937 gen(seed);
+        std::normal_distribution<double> normal(0, 1);
+        std::normal_distribution<double> perturb(0, noise > 0 ? noise : 1);
+
+        PointCloud points(n, std::vector<double>(dim));
+        for (std::vector<double>& p : points) {
+            // normalized gaussian vectors are uniform on the sphere
+            double norm = 0;
+            while (norm == 0) {
+                for (double& x : p) { x = normal(gen); }
+                norm = std::sqrt(std::inner_product(p.begin(), p.end(), p.begin(), 0.0));
+            }
+            for (double& x : p) { x = x / norm + (noise > 0 ? perturb(gen) : 0); }
+        }
+        return points;
+    }
+
+    PointCloud torusCloud(const int& n, const double& R, const double& r,
+            const double& noise, const unsigned& seed) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> angle(0, 2*M_PI);
+        std::uniform_real_distribution<double> unif(0, 1);
+        std::normal_distribution<double> perturb(0, noise > 0 ? noise : 1);
+
+        PointCloud points(n, std::vector<double>(3));
+        for (std::vector<double>& p : points) {
+            // rejection sampling, the area element is proportional to R + r*cos(theta)
+            double theta = angle(gen);
+            while (unif(gen) > (R + r*std::cos(theta)) / (R + r)) { theta = angle(gen); }
+            const double phi = angle(gen);
+
+            p[0] = (R + r*std::cos(theta)) * std::cos(phi);
+            p[1] = (R + r*std::cos(theta)) * std::sin(phi);
+            p[2] = r*std::sin(theta);
+            if (noise > 0) {
+                for (double& x : p) { x += perturb(gen); }
+            }
+        }
+        return points;
+    }
+
+    std::vector<double> flatten(const PointCloud& points) {
+        std::vector<double> coords;
+        coords.reserve(points.empty() ? 0 : points.size() * points[0].size());
+        for (const std::vector<double>& p : points) {
+            coords.insert(coords.end(), p.begin(), p.end());
+        }
+        return coords;
+    }
+
+    top::Complex<ts::tstepdouble,int> ripsComplex(const PointCloud& points, const double& max_radius, const int& max_dim) {
+        UpperGraph upper;   neighborGraph(points, 2*max_radius, upper);
+
+        const auto value = [&](const std::vector<int>& clique, const double& time, const int& vertex) {
+            double sq_diam = 0;
+            for (const int& v : clique) {
+                sq_diam = std::max(sq_diam, squaredDistance(points[v], points[vertex]));
+            }
+            return std::max(time, std::sqrt(sq_diam) / 2);
+        };
+        return cliqueComplex<ts::tstepdouble>(upper, max_dim, value);
+    }
+
+    top::Complex<ts::tstepdouble,int> cechComplex(const PointCloud& points, const double& max_radius, const int& max_dim) {
+        UpperGraph upper;   neighborGraph(points, 2*max_radius, upper);
+
+        const int dim = points.empty() ? 0 : points[0].size();
+        std::vector<const double*> coords;
+        const auto value = [&](const std::vector<int>& clique, const double& time, const int& vertex) {
+            coords.clear();
+            for (const int& v : clique) { coords.push_back(points[v].data()); }
+            coords.push_back(points[vertex].data());
+
+            const MB mb(dim, coords.data(), coords.data() + coords.size());
+            const double radius = std::sqrt(mb.squared_radius());
+            // the enclosing ball only grows, so the cofaces can be skipped as well
+            return radius > max_radius ? -1 : std::max(time, radius);
+        };
+        return cliqueComplex<ts::tstepdouble>(upper, max_dim, value);
+    }
+
+    top::Complex<ts::tstep,int> randomComplex(const int& n_vertices, const double& edge_probability,
+            const int& max_dim, const int& max_time, const unsigned& seed) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> unif(0, 1);
+        std::uniform_int_distribution<int> time(1, max_time);
+
+        // sample the edges by skipping over the geometrically distributed gaps
+        // (Batagelj and Brandes), this is linear in the number of edges
+        std::vector<std::vector<std::pair<int,int>>> edges(n_vertices);
+        if (edge_probability > 0) {
+            const double log_q = std::log(1 - std::min(edge_probability, 1.0));
+            long v = 1, w = -1;
+            while (v < n_vertices) {
+                w += 1 + (edge_probability >= 1 ? 0 : long(std::floor(std::log(1 - unif(gen)) / log_q)));
+                while (w >= v && v < n_vertices) { w -= v; ++v; }
+                if (v < n_vertices) { edges[w].push_back({ int(v), time(gen) }); }
+            }
+        }
+
+        UpperGraph upper(n_vertices);
+        for (int vertex = 0; vertex < n_vertices; vertex++) {
+            std::sort(edges[vertex].begin(), edges[vertex].end());
+            for (const std::pair<int,int>& edge : edges[vertex]) { upper[vertex].push_back(edge.first); }
+        }
+
+        const auto edgeTime = [&](const int& a, const int& b) {
+            const std::vector<int>& neighbors = upper[a];
+            const int idx = std::lower_bound(neighbors.begin(), neighbors.end(), b) - neighbors.begin();
+            return edges[a][idx].second;
+        };
+        const auto value = [&](const std::vector<int>& clique, const double& t, const int& vertex) {
+            double vertex_time = t;
+            for (const int& v : clique) {
+                vertex_time = std::max(vertex_time, double(edgeTime(v, vertex)));
+            }
+            return vertex_time;
+        };
+        return cliqueComplex<ts::tstep>(upper, max_dim, value);
+    }
+}
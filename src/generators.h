@@ -0,0 +1,74 @@
+#ifndef _GENERATORS_H
+#define _GENERATORS_H
+
+#include <vector>
+#include <random>
+
+#include "linalg.h"
+#include "topology.h"
+#include "toprep.h"
+#include "tstep.h"
+#include "tstepdouble.h"
+
+/// Reproducible synthetic inputs for tests, benchmarks and scaling studies.
+/// All generators are deterministic for a given seed.
+namespace gen {
+
+    /// a point cloud, each point is stored in the format taken by
+    /// geometricTriangulation*::insertPoint
+    using PointCloud = std::vector<std::vector<double>>;
+
+    // POINT CLOUDS
+
+    /// uniform samples from the cube [0,side]^dim
+    PointCloud uniformCloud(const int& n, const int& dim, const unsigned& seed, const double& side=1);
+    /// samples from a mixture of gaussians with the given deviation, the centers
+    /// are uniform in [0,1]^dim and every component is equally likely
+    PointCloud gaussianMixture(const int& n, const int& dim, const int& components,
+            const double& sigma, const unsigned& seed);
+    /// uniform samples from the unit sphere S^(dim-1) in R^dim with gaussian noise
+    PointCloud sphereCloud(const int& n, const int& dim, const double& noise, const unsigned& seed);
+    /// uniform (with respect to area) samples from the torus in R^3 with the
+    /// major radius R and minor radius r, with gaussian noise
+    PointCloud torusCloud(const int& n, const double& R, const double& r,
+            const double& noise, const unsigned& seed);
+
+    /// stores the points in a contiguous N x D coordinate buffer
+    std::vector<double> flatten(const PointCloud&);
+
+    /// inserts the points into a triangulation (geometricTriangulation2/3/D) in one
+    /// bulk insertion, the i-th point gets the vertex index i
+    template <typename Triangulation>
+    void insertPoints(Triangulation&, const PointCloud&);
+
+    // COMPLEXES
+
+    /// Vietoris-Rips complex up to dimension max_dim, a simplex appears at half of its
+    /// diameter (so the values are comparable to the enclosing ball radii of a Delaunay
+    /// complex), only simplices up to max_radius are included
+    top::Complex<ts::tstepdouble,int> ripsComplex(const PointCloud&, const double& max_radius, const int& max_dim);
+    /// Cech complex up to dimension max_dim, a simplex appears at the radius of its
+    /// smallest enclosing ball, only simplices up to max_radius are included
+    top::Complex<ts::tstepdouble,int> cechComplex(const PointCloud&, const double& max_radius, const int& max_dim);
+
+    /// clique complex of a random G(n,p) graph up to dimension max_dim, the edges appear
+    /// at uniform random times in [1,max_time] and the vertices at time 0
+    top::Complex<ts::tstep,int> randomComplex(const int& n_vertices, const double& edge_probability,
+            const int& max_dim, const int& max_time, const unsigned& seed);
+
+    // MATRICES
+
+    /// the boundary of a random clique complex (see randomComplex)
+    template <typename number>
+    toprep::Map<number,ts::tstep> randomBoundary(const int& n_vertices, const double& edge_probability,
+            const int& max_dim, const int& max_time, const unsigned& seed);
+
+    /// a random filtered upper triangular matrix, column j has up to
+    /// entries non-zeros in the rows < j (this is not a boundary, D*D != 0)
+    template <typename number>
+    la::Matrix<number,ts::tstep> randomFilteredMatrix(const int& dim, const int& entries, const unsigned& seed);
+}
+
+#include "generators.hpp"
+
+#endif
@@ -0,0 +1,46 @@
+#include <algorithm>
+
+namespace gen {
+
+    template <typename Triangulation>
+    void insertPoints(Triangulation& T, const PointCloud& points) {
+        const std::vector<double> coords = flatten(points);
+        T.insertPoints(coords.data(), points.size());
+    }
+
+    template <typename number>
+    toprep::Map<number,ts::tstep> randomBoundary(const int& n_vertices, const double& edge_probability,
+            const int& max_dim, const int& max_time, const unsigned& seed) {
+        top::Complex<ts::tstep,int> C = randomComplex(n_vertices, edge_probability, max_dim, max_time, seed);
+        C.finalize();
+        return top::boundary<number,ts::tstep>(C);
+    }
+
+    template <typename number>
+    la::Matrix<number,ts::tstep> randomFilteredMatrix(const int& dim, const int& entries, const unsigned& seed) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> value(1, 2);
+
+        std::vector<ts::tstep> times;   times.reserve(dim);
+        for (int i = 0; i < dim; i++) { times.push_back(i); }
+
+        la::Matrix<number,ts::tstep> D(dim, dim, times, times);
+        std::vector<int> rows;
+        for (int colN = 1; colN < dim; colN++) {
+            std::uniform_int_distribution<int> row(0, colN-1);
+
+            rows.clear();
+            for (int k = 0; k < entries; k++) { rows.push_back(row(gen)); }
+            std::sort(rows.begin(), rows.end());
+            rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+            for (const int& rowN : rows) {
+                // only the nonzero elements of the field (1 in binary), so the column has all the entries
+                number val = value(gen);
+                while (val == 0) { val = value(gen); }
+                D.lazyAppend(rowN, colN, val);
+            }
+        }
+        return D;
+    }
+}
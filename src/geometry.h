@@ -7,19 +7,26 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <unordered_set>
+#include <array>
 #include <algorithm>
 #include <iomanip>
 #include <iterator>
+#include <numeric>
 
 
 #include <ctime>
 #include <random>
 
 
+#include <boost/functional/hash.hpp>
+
 #include <CGAL/algorithm.h>
 #include <CGAL/Timer.h>
 #include <CGAL/assertions.h>
 #include <CGAL/point_generators_d.h>
+#include <CGAL/spatial_sort.h>
+#include <CGAL/property_map.h>
 
 
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
@@ -28,11 +35,22 @@
 #include <CGAL/Delaunay_triangulation_3.h>
 #include <CGAL/Delaunay_triangulation.h>
 #include <CGAL/Epick_d.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/Triangulation_data_structure.h>
+#include <CGAL/Triangulation_vertex.h>
+#include <CGAL/Triangulation_full_cell.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/Spatial_sort_traits_adapter_d.h>
 
 
 #include "topology.h"
 #include "Miniball.h"
+#include "meb.h"
+#include "filtration.h"
 #include "tstepdouble.h"
+#include "stats.h"
 
 typedef double* const* PointIterator;
 typedef const double* CoordIterator;
@@ -42,19 +60,28 @@ typedef Miniball:: Miniball <Miniball::CoordAccessor<PointIterator, CoordIterato
 // CGAL doesnt like it if we wrap this in a new namespace
 
 
+// the value of a simplex: Cech is the radius of its smallest enclosing ball, Alpha
+// the radius of its smallest empty circumsphere (see filtration::alphaComplex)
+enum class FiltrationType { Cech, Alpha };
+
+
 
 class geometricTriangulation2{
 private:
 	typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
 	// move typedefs to latter
-	typedef CGAL::Delaunay_triangulation_2<K>  DelT;
+	// the vertices store their index
+	typedef CGAL::Triangulation_vertex_base_with_info_2<int,K>     Vb;
+	typedef CGAL::Triangulation_data_structure_2<Vb>               Tds;
+	typedef CGAL::Delaunay_triangulation_2<K,Tds>  DelT;
 	typedef DelT::Point                        Point;
+	typedef DelT::Vertex_handle                Vertex_handle;
+	// sorts the indices of the points in a buffer
+	typedef CGAL::Spatial_sort_traits_adapter_2<K,CGAL::Pointer_property_map<Point>::type> SortTraits;
 
 	DelT DT;
-	std::map<Point,int> point_map;
-	std::map<int,Point> point_lookup;
-
-	double *coord[3];
+	// the number of points inserted, the next point gets this index
+	int num_points;
 
 public:
 	geometricTriangulation2();
@@ -62,18 +89,21 @@ public:
 
 
 	void insertPoint(const std::vector<double>& );
-
-	int vertexMap(const Point& p) {
-		return point_map[p];
-	}
+	/// inserts the n points of the n x 2 coordinate buffer, they are spatially
+	/// sorted first so every point is located starting next to the previous one,
+	/// the i-th point gets the vertex index i plus the number of points inserted
+	/// before (a duplicate point keeps the index of its first copy)
+	void insertPoints(const double* coords, const int& n);
 
 private:
-	top::Simplex<int> makeSimplex(const std::vector<Point>&) ;
-	void subComplex(top::Complex<ts::tstepdouble,int>&,std::vector<Point>);
-	double findTime(const std::vector<Point>&) ;
+	// the coordinates in an N x D buffer by the vertex indices
+	std::vector<double> vertexCoordinates() const;
+	top::Complex<ts::tstepdouble,int> alphaComplex(const filtration::Value& value);
 
 public:
-	top::Complex<ts::tstepdouble,int> outputComplex();
+	/// the values are the radii or the squared radii (see filtration::Value)
+	top::Complex<ts::tstepdouble,int> outputComplex(const FiltrationType& type = FiltrationType::Cech,
+		const filtration::Value& value = filtration::Value::Radius);
 
 };
 
@@ -82,14 +112,24 @@ class geometricTriangulation3{
 private:
 	typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
 	// move typedefs to latter
-	typedef CGAL::Delaunay_triangulation_3<K>  DelT;
+	// the vertices store their index
+	typedef CGAL::Triangulation_vertex_base_with_info_3<int,K>     Vb;
+	typedef CGAL::Delaunay_triangulation_cell_base_3<K>            Cb;
+#ifdef CGAL_LINKED_WITH_TBB
+	// the bulk insertion runs in parallel
+	typedef CGAL::Triangulation_data_structure_3<Vb,Cb,CGAL::Parallel_tag> Tds;
+#else
+	typedef CGAL::Triangulation_data_structure_3<Vb,Cb>            Tds;
+#endif
+	typedef CGAL::Delaunay_triangulation_3<K,Tds>  DelT;
 	typedef DelT::Point                        Point;
+	typedef DelT::Vertex_handle                Vertex_handle;
+	// sorts the indices of the points in a buffer
+	typedef CGAL::Spatial_sort_traits_adapter_3<K,CGAL::Pointer_property_map<Point>::type> SortTraits;
 
 	DelT DT;
-	std::map<Point,int> point_map;
-	std::map<int,Point> point_lookup;
-
-	double *coord[4];
+	// the number of points inserted, the next point gets this index
+	int num_points;
 
 public:
 	geometricTriangulation3();
@@ -97,18 +137,22 @@ public:
 
 
 	void insertPoint(const std::vector<double>& );
-
-	int vertexMap(const Point& p) {
-		return point_map[p];
-	}
+	/// inserts the n points of the n x 3 coordinate buffer, they are spatially
+	/// sorted first so every point is located starting next to the previous one
+	/// (in parallel with TBB), the i-th point gets the vertex index i plus the
+	/// number of points inserted before (a duplicate point keeps the index of one
+	/// of its copies)
+	void insertPoints(const double* coords, const int& n);
 
 private:
-	top::Simplex<int> makeSimplex(const std::vector<Point>&) ;
-	void subComplex(top::Complex<ts::tstepdouble,int>&,std::vector<Point>);
-	double findTime(const std::vector<Point>&) ;
+	// the coordinates in an N x D buffer by the vertex indices
+	std::vector<double> vertexCoordinates() const;
+	top::Complex<ts::tstepdouble,int> alphaComplex(const filtration::Value& value);
 
 public:
-	top::Complex<ts::tstepdouble,int> outputComplex();
+	/// the values are the radii or the squared radii (see filtration::Value)
+	top::Complex<ts::tstepdouble,int> outputComplex(const FiltrationType& type = FiltrationType::Cech,
+		const filtration::Value& value = filtration::Value::Radius);
 
 };
 
@@ -119,14 +163,19 @@ class geometricTriangulationD{
 private:
 
 	typedef CGAL::Epick_d< CGAL::Dimension_tag<D> >               K;
-	typedef CGAL::Delaunay_triangulation<K>                       DelT;
+	// the vertices store their index
+	typedef CGAL::Triangulation_data_structure< CGAL::Dimension_tag<D>,
+		CGAL::Triangulation_vertex<K,int>,
+		CGAL::Triangulation_full_cell<K> >                    Tds;
+	typedef CGAL::Delaunay_triangulation<K,Tds>                   DelT;
 	typedef typename DelT::Point                       	      Point;
+	typedef typename DelT::Vertex_handle                          Vertex_handle;
+	// sorts the indices of the points in a buffer
+	typedef CGAL::Spatial_sort_traits_adapter_d<K,typename CGAL::Pointer_property_map<Point>::type> SortTraits;
 
 	DelT DT;
-	std::map<Point,int> point_map;
-	std::map<int,Point> point_lookup;
-
-	double *coord[D+1];
+	// the number of points inserted, the next point gets this index
+	int num_points;
 
 public:
 	geometricTriangulationD();
@@ -134,18 +183,26 @@ public:
 
 
 	void insertPoint(const std::vector<double>& );
-
-	int vertexMap(const Point& p) {
-		return point_map[p];
-	}
+	/// inserts the n points of the n x D coordinate buffer, they are spatially
+	/// sorted first so every point is located starting next to the previous one,
+	/// the i-th point gets the vertex index i plus the number of points inserted
+	/// before (a duplicate point keeps the index of its first copy)
+	void insertPoints(const double* coords, const int& n);
 
 private:
-	top::Simplex<int> makeSimplex(const std::vector<Point>&) ;
-	void subComplex(top::Complex<ts::tstepdouble,int>&,std::vector<Point>);
-	double findTime(const std::vector<Point>&) ;
+	// the sorted vertex indices of a simplex, padded with -1
+	typedef std::array<int,D+1> Face;
+	// the simplices which were already emitted
+	typedef std::unordered_set<Face,boost::hash<Face>> FaceSet;
+
+	// the coordinates in an N x D buffer by the vertex indices
+	std::vector<double> vertexCoordinates() const;
+	top::Complex<ts::tstepdouble,int> alphaComplex(const filtration::Value& value);
 
 public:
-	top::Complex<ts::tstepdouble,int> outputComplex();
+	/// the values are the radii or the squared radii (see filtration::Value)
+	top::Complex<ts::tstepdouble,int> outputComplex(const FiltrationType& type = FiltrationType::Cech,
+		const filtration::Value& value = filtration::Value::Radius);
 
 };
 
@@ -3,105 +3,117 @@
 
 geometricTriangulation2::geometricTriangulation2():
 	DT(),
-	point_map(),
-	point_lookup() {
-		for(int i=0;i<3;++i){
-			coord[i] = new double[2];
-		}
-	}
+	num_points(0) {}
 
 
 geometricTriangulation2::geometricTriangulation2(std::initializer_list<std::vector<double>> points):
 	DT(),
-	point_map(),
-	point_lookup() {
-
-	for(int i=0;i<3;++i){
-		coord[i] = new double[2];
-	}
+	num_points(0) {
 
 	for(auto p : points ){
-		DT.insert(Point(p[0],p[1]));
+		insertPoint(p);
 	}
 }
 
 void geometricTriangulation2::insertPoint(const std::vector<double> &p){
 	DEBUG_ASSERT(p.size()==2);
-	DT.insert(Point(p[0],p[1]));
+	insertPoints(p.data(),1);
 }
 
+void geometricTriangulation2::insertPoints(const double* coords, const int& n){
+	STATS_PHASE(Insertion);
+	std::vector<Point> points;
+	points.reserve(n);
+	for(int i=0;i<n;++i){
+		points.push_back(Point(coords[2*i],coords[2*i+1]));
+	}
 
+	// sort the indices, so the points keep their position in the buffer
+	std::vector<std::ptrdiff_t> order(n);
+	std::iota(order.begin(),order.end(),0);
+	CGAL::spatial_sort(order.begin(),order.end(),SortTraits(CGAL::make_property_map(points)));
+
+	DelT::Face_handle hint;
+	for(auto i : order){
+		const std::size_t before = DT.number_of_vertices();
+		const DelT::Vertex_handle v = DT.insert(points[i],hint);
+		hint = v->face();
+		// a duplicate keeps the index of its first copy
+		if(DT.number_of_vertices()>before){
+			v->info() = num_points+i;
+		}
+	}
+	num_points += n;
+}
 
 
-top::Simplex<int> geometricTriangulation2::makeSimplex(const std::vector<Point>& pArray) {
-	std::vector<int> tmp;
-	for(auto x : pArray){
-		tmp.push_back(point_map[x]);
+std::vector<double> geometricTriangulation2::vertexCoordinates() const {
+	std::vector<double> coords(2*num_points);
+	for(auto it = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
+		coords[2*it->info()]=CGAL::to_double(it->point().x());
+		coords[2*it->info()+1]=CGAL::to_double(it->point().y());
 	}
-	return top::Simplex<int>(tmp);
+	return coords;
 }
 
-double geometricTriangulation2::findTime(const std::vector<Point>& pArray ) {
- // first make double
-  // this should be a persistena
-
 
+top::Complex<ts::tstepdouble,int> geometricTriangulation2::alphaComplex(const filtration::Value& value){
+	STATS_PHASE(Faces);
+	const std::vector<double> coords = vertexCoordinates();
 
-   int j=0;
-   for(auto p : pArray){
-	coord[j][0]=CGAL::to_double(p.x());
-	coord[j][1]=CGAL::to_double(p.y());
-    	j++;
-   }
-	
-   MB mb(2,coord,coord+j);
+	// the top cells, the vertices are cells as well in case there are no edges
+	std::vector<std::vector<int>> cells;
+	for(auto it = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
+		cells.push_back({ it->info() });
+	}
+	if(DT.dimension()==1){
+		for(auto it = DT.finite_edges_begin(); it!=DT.finite_edges_end();++it){
+			cells.push_back({ it->first->vertex(DT.cw(it->second))->info(),
+				it->first->vertex(DT.ccw(it->second))->info() });
+		}
+	}
+	for(auto it = DT.finite_faces_begin(); it!=DT.finite_faces_end();++it){
+		std::vector<int> cell;
+		for(int i=0;i<3;++i){
+			cell.push_back(it->vertex(i)->info());
+		}
+		cells.push_back(cell);
+	}
 
-   return std::sqrt(mb.squared_radius()); 
+	return filtration::alphaComplex<2>(coords.data(),cells,value);
 }
 
 
-void geometricTriangulation2::subComplex(top::Complex<ts::tstepdouble,int> &C, std::vector<Point> listPoints) {
-	
-	if(listPoints.size()==1){
-		C.insert(top::Simplex<int>(makeSimplex(listPoints)),0);
-		return;
-	}
-	int dim = listPoints.size();
+top::Complex<ts::tstepdouble,int> geometricTriangulation2::outputComplex(const FiltrationType& type, const filtration::Value& value){
 
-	C.insert(top::Simplex<int>(makeSimplex(listPoints)),findTime(listPoints));  
-
-	for(int i = 0; i<dim; ++i){
-		Point p = listPoints.back();
-		listPoints.pop_back();
-		subComplex(C, listPoints);
-		listPoints.push_back(p);
-		std::swap(listPoints[i],listPoints[dim-1]);
+	if(type==FiltrationType::Alpha){
+		return alphaComplex(value);
 	}
 
-}
-
-top::Complex<ts::tstepdouble,int> geometricTriangulation2::outputComplex(){
-	
-	top::Complex<ts::tstepdouble,int> C;
-	
-	int i=0;
-	for(auto it  = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
-		point_map[it->point()]=i;
-		point_lookup[i++]=it->point();
+	// collect the vertices, edges and faces separately, so every simplex is
+	// inserted (and its radius computed) once, even if it is shared by
+	// several triangles
+	STATS_PHASE(Faces);
+	std::vector<std::vector<int>> faces(3);
+	for(auto it = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
+		faces[0].push_back(it->info());
+	}
 
-	}	
+	for(auto it = DT.finite_edges_begin(); it!=DT.finite_edges_end();++it){
+		const typename DelT::Face_handle f = it->first;
+		faces[1].push_back(f->vertex(DT.cw(it->second))->info());
+		faces[1].push_back(f->vertex(DT.ccw(it->second))->info());
+	}
 
-	for(auto it = DT.finite_faces_begin(); it!=DT.finite_faces_end();it++){
-		std::vector<Point> listPoints;
+	for(auto it = DT.finite_faces_begin(); it!=DT.finite_faces_end();++it){
         	for(int i=0;i<3;++i){
-     			typename DelT::Vertex_handle vh = it->vertex(i);
-             		listPoints.push_back(vh->point());
+             		faces[2].push_back(it->vertex(i)->info());
 		}
-		// make top simplex
-		subComplex(C,listPoints);
 	}
 
-return C;
+	// the radii are computed in parallel
+	const std::vector<double> coords = vertexCoordinates();
+	return filtration::cechComplex<2>(coords.data(),faces,value);
 }
 
 
@@ -116,104 +128,161 @@ return C;
 
 geometricTriangulation3::geometricTriangulation3():
 	DT(),
-	point_map(),
-	point_lookup() {
-		for(int i=0;i<4;++i){
-			coord[i] = new double[3];
-		}
-	}
+	num_points(0) {}
 
 
 geometricTriangulation3::geometricTriangulation3(std::initializer_list<std::vector<double>> points):
 	DT(),
-	point_map(),
-	point_lookup() {
-
-	for(int i=0;i<4;++i){
-		coord[i] = new double[3];
-	}
+	num_points(0) {
 
 	for(auto p : points ){
-		DT.insert(Point(p[0],p[1],p[2]));
+		insertPoint(p);
 	}
 }
 
 void geometricTriangulation3::insertPoint(const std::vector<double> &p){
 	DEBUG_ASSERT(p.size()==3);
-	DT.insert(Point(p[0],p[1],p[2]));
+	insertPoints(p.data(),1);
 }
 
+void geometricTriangulation3::insertPoints(const double* coords, const int& n){
+	STATS_PHASE(Insertion);
+	std::vector<Point> points;
+	points.reserve(n);
+	for(int i=0;i<n;++i){
+		points.push_back(Point(coords[3*i],coords[3*i+1],coords[3*i+2]));
+	}
 
+#ifdef CGAL_LINKED_WITH_TBB
+	// the parallel insertion locks the cells through a grid over the bounding box
+	// and does its own spatial sort
+	if(n>1){
+		std::vector<std::pair<Point,int>> indexed;
+		indexed.reserve(n);
+		double lo[3] = { coords[0], coords[1], coords[2] };
+		double hi[3] = { coords[0], coords[1], coords[2] };
+		for(int i=0;i<n;++i){
+			indexed.push_back(std::make_pair(points[i],num_points+i));
+			for(int j=0;j<3;++j){
+				lo[j] = std::min(lo[j],coords[3*i+j]);
+				hi[j] = std::max(hi[j],coords[3*i+j]);
+			}
+		}
 
-
-top::Simplex<int> geometricTriangulation3::makeSimplex(const std::vector<Point>& pArray) {
-	std::vector<int> tmp;
-	for(auto x : pArray){
-		tmp.push_back(point_map[x]);
+		DelT::Lock_data_structure locks(CGAL::Bbox_3(lo[0],lo[1],lo[2],hi[0],hi[1],hi[2]),50);
+		DT.set_lock_data_structure(&locks);
+		DT.insert(indexed.begin(),indexed.end());
+		DT.set_lock_data_structure(nullptr);
+		num_points += n;
+		return;
 	}
-	return top::Simplex<int>(tmp);
+#endif
+
+	// sort the indices, so the points keep their position in the buffer
+	std::vector<std::ptrdiff_t> order(n);
+	std::iota(order.begin(),order.end(),0);
+	CGAL::spatial_sort(order.begin(),order.end(),SortTraits(CGAL::make_property_map(points)));
+
+	DelT::Cell_handle hint;
+	for(auto i : order){
+		const std::size_t before = DT.number_of_vertices();
+		const DelT::Vertex_handle v = DT.insert(points[i],hint);
+		hint = v->cell();
+		// a duplicate keeps the index of its first copy
+		if(DT.number_of_vertices()>before){
+			v->info() = num_points+i;
+		}
+	}
+	num_points += n;
 }
 
-double geometricTriangulation3::findTime(const std::vector<Point>& pArray ) {
- // first make double
-  // this should be a persistena
-
-   int j=0;
-   for(auto p : pArray){
-	coord[j][0]=CGAL::to_double(p.x());
-	coord[j][1]=CGAL::to_double(p.y());
-    	coord[j][2]=CGAL::to_double(p.z());
-    	j++;
-   }
-	
-   MB mb(3,coord,coord+j);
-
-   return std::sqrt(mb.squared_radius()); 
+
+std::vector<double> geometricTriangulation3::vertexCoordinates() const {
+	std::vector<double> coords(3*num_points);
+	for(auto it = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
+		coords[3*it->info()]=CGAL::to_double(it->point().x());
+		coords[3*it->info()+1]=CGAL::to_double(it->point().y());
+		coords[3*it->info()+2]=CGAL::to_double(it->point().z());
+	}
+	return coords;
 }
 
 
-void geometricTriangulation3::subComplex(top::Complex<ts::tstepdouble,int> &C, std::vector<Point> listPoints) {
-	
-	if(listPoints.size()==1){
-		C.insert(top::Simplex<int>(makeSimplex(listPoints)),0);
-		return;
+top::Complex<ts::tstepdouble,int> geometricTriangulation3::alphaComplex(const filtration::Value& value){
+	STATS_PHASE(Faces);
+	const std::vector<double> coords = vertexCoordinates();
+
+	// the top cells, the vertices are cells as well in case there are no edges
+	std::vector<std::vector<int>> cells;
+	for(auto it = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
+		cells.push_back({ it->info() });
+	}
+	if(DT.dimension()==1){
+		for(auto it = DT.finite_edges_begin(); it!=DT.finite_edges_end();++it){
+			cells.push_back({ it->first->vertex(it->second)->info(),
+				it->first->vertex(it->third)->info() });
+		}
+	}
+	if(DT.dimension()==2){
+		for(auto it = DT.finite_facets_begin(); it!=DT.finite_facets_end();++it){
+			std::vector<int> cell;
+			for(int i=1;i<4;++i){
+				cell.push_back(it->first->vertex((it->second+i)&3)->info());
+			}
+			cells.push_back(cell);
+		}
+	}
+	for(auto it = DT.finite_cells_begin(); it!=DT.finite_cells_end();++it){
+		std::vector<int> cell;
+		for(int i=0;i<4;++i){
+			cell.push_back(it->vertex(i)->info());
+		}
+		cells.push_back(cell);
 	}
-	int dim = listPoints.size();
 
-	C.insert(top::Simplex<int>(makeSimplex(listPoints)),findTime(listPoints));  
+	return filtration::alphaComplex<3>(coords.data(),cells,value);
+}
+
+
+top::Complex<ts::tstepdouble,int> geometricTriangulation3::outputComplex(const FiltrationType& type, const filtration::Value& value){
 
-	for(int i = 0; i<dim; ++i){
-		Point p = listPoints.back();
-		listPoints.pop_back();
-		subComplex(C, listPoints);
-		listPoints.push_back(p);
-		std::swap(listPoints[i],listPoints[dim-1]);
+	if(type==FiltrationType::Alpha){
+		return alphaComplex(value);
 	}
 
-}
+	// collect the vertices, edges, facets and cells separately, so every simplex
+	// is inserted (and its radius computed) once, an edge is shared by about
+	// five tetrahedra on average
+	STATS_PHASE(Faces);
+	std::vector<std::vector<int>> faces(4);
+	for(auto it = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
+		faces[0].push_back(it->info());
+	}
 
-top::Complex<ts::tstepdouble,int> geometricTriangulation3::outputComplex(){
-	
-	top::Complex<ts::tstepdouble,int> C;
-	
-	int i=0;
-	for(auto it  = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
-		point_map[it->point()]=i;
-		point_lookup[i++]=it->point();
+	for(auto it = DT.finite_edges_begin(); it!=DT.finite_edges_end();++it){
+		// an edge is a cell with the indices of its two vertices
+		const typename DelT::Cell_handle c = it->first;
+		faces[1].push_back(c->vertex(it->second)->info());
+		faces[1].push_back(c->vertex(it->third)->info());
+	}
 
-	}	
+	for(auto it = DT.finite_facets_begin(); it!=DT.finite_facets_end();++it){
+		// a facet is a cell with the index of the opposite vertex
+		const typename DelT::Cell_handle c = it->first;
+		for(int i=1;i<4;++i){
+			faces[2].push_back(c->vertex((it->second+i)&3)->info());
+		}
+	}
 
-	for(auto it = DT.finite_cells_begin(); it!=DT.finite_cells_end();it++){
-		std::vector<Point> listPoints;
+	for(auto it = DT.finite_cells_begin(); it!=DT.finite_cells_end();++it){
         	for(int i=0;i<4;++i){
-     			typename DelT::Vertex_handle vh = it->vertex(i);
-             		listPoints.push_back(vh->point());
+             		faces[3].push_back(it->vertex(i)->info());
 		}
-		// make top simplex
-		subComplex(C,listPoints);
 	}
 
-return C;
+	// the radii are computed in parallel
+	const std::vector<double> coords = vertexCoordinates();
+	return filtration::cechComplex<3>(coords.data(),faces,value);
 }
 
 //
@@ -228,27 +297,17 @@ return C;
 template<const int D>
 geometricTriangulationD<D>::geometricTriangulationD():
 	DT(D),
-	point_map(),
-	point_lookup() {
-		for(int i=0;i<D+1;++i){
-			coord[i] = new double[D];
-		}
-	}
+	num_points(0) {}
 
 
 
 template<const int D>
 geometricTriangulationD<D>::geometricTriangulationD(std::initializer_list<std::vector<double>> points):
 	DT(D),
-	point_map(),
-	point_lookup() {
-
-	for(int i=0;i<D+1;++i){
-		coord[i] = new double[D];
-	}
+	num_points(0) {
 
 	for(auto p : points ){
-		DT.insert(Point(p.begin(),p.end()));
+		insertPoint(p);
 	}
 }
 
@@ -256,90 +315,121 @@ geometricTriangulationD<D>::geometricTriangulationD(std::initializer_list<std::v
 template<const int D>
 void geometricTriangulationD<D>::insertPoint(const std::vector<double> &p){
 	DEBUG_ASSERT(p.size()==D);
-
-	DT.insert(Point(p.begin(),p.end()));
+	insertPoints(p.data(),1);
 }
 
-
-
-
-
 template<const int D>
-top::Simplex<int> geometricTriangulationD<D>::makeSimplex(const std::vector<Point>& pArray) {
-	std::vector<int> tmp;
-	for(auto x : pArray){
-		tmp.push_back(point_map[x]);
+void geometricTriangulationD<D>::insertPoints(const double* coords, const int& n){
+	STATS_PHASE(Insertion);
+	std::vector<Point> points;
+	points.reserve(n);
+	for(int i=0;i<n;++i){
+		points.push_back(Point(coords+D*i,coords+D*(i+1)));
+	}
+
+	// sort the indices, so the points keep their position in the buffer
+	std::vector<std::ptrdiff_t> order(n);
+	std::iota(order.begin(),order.end(),0);
+	CGAL::spatial_sort(order.begin(),order.end(),SortTraits(CGAL::make_property_map(points)));
+
+	typename DelT::Full_cell_handle hint;
+	for(auto i : order){
+		const std::size_t before = DT.number_of_vertices();
+		const typename DelT::Vertex_handle v = DT.insert(points[i],hint);
+		hint = v->full_cell();
+		// a duplicate keeps the index of its first copy
+		if(DT.number_of_vertices()>before){
+			v->data() = num_points+i;
+		}
 	}
-	return top::Simplex<int>(tmp);
+	num_points += n;
 }
 
 
 template<const int D>
-double geometricTriangulationD<D>::findTime(const std::vector<Point>& pArray ) {
- // first make double
-  // this should be a persistena
-
-   int j=0;
-
-   for(auto p : pArray){
-     for(int i=0;i<D;++i){
-	coord[j][i]=CGAL::to_double(p[i]);
-     }
-     j++;
-   } 
-	
-   MB mb(D,coord,coord+j);
-
-   return std::sqrt(mb.squared_radius()); 
+std::vector<double> geometricTriangulationD<D>::vertexCoordinates() const {
+	std::vector<double> coords(D*num_points);
+	for(auto it = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
+		for(int i=0;i<D;++i){
+			coords[D*it->data()+i]=CGAL::to_double(it->point()[i]);
+		}
+	}
+	return coords;
 }
 
 
-
 template<const int D>
-void geometricTriangulationD<D>::subComplex(top::Complex<ts::tstepdouble,int> &C, std::vector<Point> listPoints) {
-	
-	if(listPoints.size()==1){
-		C.insert(top::Simplex<int>(makeSimplex(listPoints)),0);
-		return;
+top::Complex<ts::tstepdouble,int> geometricTriangulationD<D>::alphaComplex(const filtration::Value& value){
+	STATS_PHASE(Faces);
+	const std::vector<double> coords = vertexCoordinates();
+
+	// the top cells, the vertices are cells as well in case there are no edges
+	std::vector<std::vector<int>> cells;
+	for(auto it = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
+		cells.push_back({ it->data() });
 	}
-	int dim = listPoints.size();
-
-	C.insert(top::Simplex<int>(makeSimplex(listPoints)),findTime(listPoints));  
-
-		for(int i = 0; i<dim; ++i){
-			Point p = listPoints.back();
-			listPoints.pop_back();
-			subComplex(C, listPoints);
-			listPoints.push_back(p);
-			std::swap(listPoints[i],listPoints[dim-1]);
+	if(DT.current_dimension()>0){
+		for(auto it = DT.finite_full_cells_begin(); it!=DT.finite_full_cells_end();++it){
+			std::vector<int> cell;
+			for(int i=0;i<=DT.current_dimension();++i){
+				cell.push_back(it->vertex(i)->data());
+			}
+			cells.push_back(cell);
 		}
-
 	}
 
+	return filtration::alphaComplex<D>(coords.data(),cells,value);
+}
 
-	template<const int D>
-	top::Complex<ts::tstepdouble,int> geometricTriangulationD<D>::outputComplex(){
-		
-		top::Complex<ts::tstepdouble,int> C;
-		
-		int i=0;
-		for(auto it  = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
-			point_map[it->point()]=i;
-		point_lookup[i++]=it->point();
 
-	}	
+template<const int D>
+top::Complex<ts::tstepdouble,int> geometricTriangulationD<D>::outputComplex(const FiltrationType& type, const filtration::Value& value){
 
-	for(auto it = DT.full_cells_begin(); it!=DT.full_cells_end();it++){
-		std::vector<Point> listPoints;
-        	for(int i=0;i<4;++i){
-     			typename DelT::Vertex_handle vh = it->vertex(i);
-             		listPoints.push_back(vh->point());
+	if(type==FiltrationType::Alpha){
+		return alphaComplex(value);
+	}
+
+	// CGAL has no iterators over the faces of every dimension in dD, so the
+	// faces are enumerated per finite cell (as the subsets of its vertices) and
+	// the ones already seen in another cell are skipped
+	STATS_PHASE(Faces);
+	const int dim = std::max(DT.current_dimension(),0);
+	std::vector<std::vector<int>> faces(dim+1);
+	for(auto it = DT.finite_vertices_begin(); it!=DT.finite_vertices_end();++it){
+		faces[0].push_back(it->data());
+	}
+
+	std::vector<FaceSet> seen(dim+1);
+	Face cell, face;
+	for(auto it = DT.finite_full_cells_begin(); it!=DT.finite_full_cells_end() && dim>0;++it){
+		for(int i=0;i<=dim;++i){
+			cell[i]=it->vertex(i)->data();
+		}
+		std::sort(cell.begin(),cell.begin()+dim+1);
+		// every cell is a top simplex of its own
+		faces[dim].insert(faces[dim].end(),cell.begin(),cell.begin()+dim+1);
+
+		// the proper faces with at least two vertices by the bit masks of the vertices
+		for(unsigned mask=1;mask<(1u<<(dim+1))-1;++mask){
+			int k=0;
+			for(int i=0;i<=dim;++i){
+				if(mask>>i&1){
+					face[k++]=cell[i];
+				}
+			}
+			if(k<2){
+				continue;
+			}
+			std::fill(face.begin()+k,face.end(),-1);
+			if(seen[k-1].insert(face).second){
+				faces[k-1].insert(faces[k-1].end(),face.begin(),face.begin()+k);
+			}
 		}
-		// make top simplex
-		subComplex(C,listPoints);
 	}
 
-return C;
+	// the radii are computed in parallel
+	const std::vector<double> coords = vertexCoordinates();
+	return filtration::cechComplex<D>(coords.data(),faces,value);
 }
 
 
@@ -8,6 +8,7 @@
 
 #include "num.h"
 #include "tstep.h"
+#include "stats.h"
 
 namespace la {
 
@@ -16,12 +17,14 @@ namespace la {
 
     // forward declarations
     template <typename number, typename timeunit> class Matrix;
+    template <typename number, typename timeunit> class ReductionColumn;
 
     ////////////////////////////////////////////
     /// Sparse vector implementation
     template <typename number,typename timeunit=tstep>
     class Vector {
         friend class Matrix<number,timeunit>;
+        friend class ReductionColumn<number,timeunit>;
     private:
         using SparseEntry = std::pair<int,number>;
         using Vec = Vector<number,timeunit>;
@@ -32,6 +35,7 @@ namespace la {
         int dimension;
     public:
         using iterator = typename vector::iterator;
+        using const_iterator = typename vector::const_iterator;
 
         explicit Vector(const int& dim);
 
@@ -67,10 +71,14 @@ namespace la {
 
         iterator begin(){return vect.begin();}
         iterator end(){return vect.end();}
+        const_iterator begin() const {return vect.cbegin();}
+        const_iterator end() const {return vect.cend();}
 
 
         /// resizes the vector
         void resize(const int& dim);
+        /// raises the dimension, the entries stay
+        void grow(const int& dim) { DEBUG_ASSERT(dim >= dimension); dimension = dim; }
         /// makes the vector [0,0,...,0]
         void makeZero();
         /// sets the entry at the specified dimension to zero
@@ -112,6 +120,63 @@ namespace la {
     using BinaryVector = Vector<binary>;
     using TernaryVector = Vector<ternary>;
 
+    ////////////////////////////////////////////
+    /// The column which is being reduced. It is kept sparse while it is short,
+    /// once the fill-in makes it longer than the threshold it is scattered into
+    /// a dense coefficient array, so an addition only costs the length of the
+    /// added column. It is gathered back into a sparse vector when it shrinks
+    /// below a quarter of the threshold.
+    template <typename number,typename timeunit=tstep>
+    class ReductionColumn {
+    private:
+        using Vec = Vector<number,timeunit>;
+        using SparseEntry = typename Vec::SparseEntry;
+
+        Vec sparse;
+        Vec scratch;                // reused by the sparse additions
+        std::vector<number> dense;  // all zero while the column is sparse
+
+        bool is_dense = false;
+        int nonzeros = 0;           // only maintained in the dense mode
+        int pivot_dim = -1;         // only maintained in the dense mode
+
+        int dense_threshold;
+        int sparse_threshold;
+
+    public:
+        /// the default threshold is max(MIN_DENSE, dim/DENSE_RATIO), so scanning the
+        /// dense array costs about as much as merging the column a few times
+        static constexpr int MIN_DENSE = 64;
+        static constexpr int DENSE_RATIO = 32;
+
+        /// creates a reducer for columns of the given dimension, a non-positive
+        /// threshold selects the default
+        explicit ReductionColumn(const int& dim, const int& dense_threshold=0);
+
+        /// starts reducing the column (takes its contents)
+        void load(Vec&& col);
+        /// moves the reduced column out
+        void store(Vec& col);
+
+        bool isZero() const { return is_dense ? nonzeros == 0 : sparse.isZero(); }
+        bool isDense() const { return is_dense; }
+        int size() const { return is_dense ? nonzeros : sparse.size(); }
+        int pivotDim() const { return is_dense ? pivot_dim : sparse.pivotDim(); }
+        number pivot() const;
+
+        /// this <- this + k*vec
+        void addMultiple(const Vec& vec, const number& k);
+
+        /// eliminates the pivot of the column using the reduced columns in the pivot
+        /// index (pivot_cols[row] is the index of the one with the pivot in row or -1),
+        /// the column goes through this one while it is being reduced
+        void reduce(Vec& col, const std::vector<int>& pivot_cols, const std::vector<Vec>& columns);
+
+    private:
+        void scatter();
+        void gather();
+    };
+
     ////////////////////////////////////////////
     /// Single entry returned from a matrix
     template <typename number,typename timeunit=tstep>
@@ -275,6 +340,13 @@ namespace la {
         std::vector<timeunit> row_times;
         std::vector<timeunit> col_times;
 
+        // rows and columns which are zeroed out lazily (see zeroRows/zeroColumns),
+        // the index lists make it possible to clear the masks in O(#zeroed)
+        std::vector<bool> row_mask;
+        std::vector<bool> col_mask;
+        std::vector<int> masked_rows;
+        std::vector<int> masked_cols;
+
     public:
         // types which are output by the matrix
         using Entry = MatrixEntry<number,timeunit>;
@@ -338,7 +410,7 @@ namespace la {
         timeunit getRowTime(const int&) const;
         /// returns the time associated with the (rowN,colN)-th entry
         timeunit getEntryTime(const int& rowN, const int& colN) const;
-        /// access the k-th column vector
+        /// access the k-th column vector (the matrix must not have any lazily zeroed rows or columns)
         VectorWrapper<number,timeunit> operator [](const int& colN) const;
 
         // PROPERTIES
@@ -365,6 +437,10 @@ namespace la {
 
         /// sets all the linearly dependent vectors to 0
         void reduce(const bool& del_zeros=false);
+        /// merges the columns of this and k*other by time into result, the columns
+        /// are inserted into a pivot index and only the ones whose pivot is already
+        /// taken get reduced (linear in the input size if both matrices are reduced)
+        void mergeReduced(const Mat& other, const number& k, Mat& result) const;
 
         /// mulitplication
         void multiply(const Mat&, Mat&) const;
@@ -372,15 +448,34 @@ namespace la {
 
         /// decompose into the kernel and image
         void decompose(Mat& kernel, Mat& image) const;
+        /// decompose into the kernel and image, the trivial columns (i.e. simplices
+        /// of a subcomplex in relative homology) are skipped and appear in neither
+        void decompose(Mat& kernel, Mat& image, const std::vector<int>& trivial_cols) const;
+        /// decompose a boundary matrix (D*D = 0) into the kernel and image, the
+        /// apparent pairs (see apparentPairs) are not reduced, the kernel vector of
+        /// the facet is taken from the boundary of its cofacet instead
+        void decompose(Mat& kernel, Mat& image, const std::vector<int>& trivial_cols,
+                const std::vector<std::pair<int,int>>& apparent_pairs) const;
+        /// finds the pairs (facet, cofacet) of a square boundary matrix where the
+        /// facet is the pivot of the cofacet and the cofacet is the first column
+        /// containing the facet, these columns never need to be reduced
+        void apparentPairs(std::vector<std::pair<int,int>>& pairs) const;
 
         /// solves the system A*X = B
         void solve(const Mat& B, Mat& X) const;
 
 
         /// for relative homology we have to be able to zero out
-        /// rows
+        /// rows, the rows and columns are only masked (the data is not
+        /// rewritten) and all the operations treat them as zero
         void zeroRows(const std::vector<int>&);
         void zeroColumns(const std::vector<int>&);
+        /// restores the rows and columns zeroed out since the last call
+        void clearMasks();
+        /// rewrites the matrix data so the zeroed rows and columns are removed
+        void applyMasks();
+        /// returns true if any rows or columns are zeroed out lazily
+        bool hasMasks() const { return !masked_rows.empty() || !masked_cols.empty(); }
 
     private:
         // helper constructors
@@ -388,7 +483,25 @@ namespace la {
         Matrix(const int& vec_count, const Vec&, Vecs const&...);
         Matrix(const int& vec_count, const Vec&);
 
+        /// the rows and columns past the masks (added after them) are not masked
+        bool isRowMasked(const int& rowN) const {
+            return !masked_rows.empty() && size_t(rowN) < row_mask.size() && row_mask[rowN];
+        }
+        bool isColMasked(const int& colN) const {
+            return !masked_cols.empty() && size_t(colN) < col_mask.size() && col_mask[colN];
+        }
+        /// returns a copy of the column without the zeroed entries
+        Vec maskedColumn(const int& colN) const;
+        /// returns the pivot of the column ignoring the zeroed entries
+        int maskedPivotDim(const int& colN) const;
+        /// copies the matrix into dest with the masks applied
+        void copyMasked(Mat& dest) const;
+
         void transpose(SparseMatrix&) const;
+        /// eliminates the pivot of the column using the columns in the pivot index
+        /// (pivot_cols[row] is the column with the pivot in row or -1), work holds
+        /// the column while it is being reduced
+        void reduceColumn(Vec&, const std::vector<int>& pivot_cols, ReductionColumn<number,timeunit>& work) const;
     };
 
     template <typename number, typename timeunit=tstep>
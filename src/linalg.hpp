@@ -183,7 +183,7 @@ namespace la {
         vector& result_vec = result.vect;
 
         if (!result_vec.empty()) { result_vec.clear(); }
-        result_vec.reserve(dim() + b.dim());
+        result_vec.reserve(vect.size() + b.vect.size());
 
         size_t a_idx = 0;
         size_t b_idx = 0;
@@ -230,7 +230,7 @@ namespace la {
         vector& result_vec = result.vect;
 
         if (!result_vec.empty()) { result_vec.clear(); }
-        result_vec.reserve(dim() + b.dim());
+        result_vec.reserve(vect.size() + b.vect.size());
 
         size_t a_idx = 0;
         size_t b_idx = 0;
@@ -274,6 +274,12 @@ namespace la {
     template <typename number, typename timeunit>
     void Vector<number,timeunit>::addMultiple(const Vec& vec, const number& k) {
         Vec result(dim()); add(vec, k, result);
+
+        STATS_ADD(column_additions, 1);
+        STATS_ADD(allocations, 1);
+        STATS_ADD(fill_in, std::max<long>(0, long(result.vect.size()) - long(vect.size())));
+        STATS_MAX(peak_column_length, result.vect.size());
+
         std::swap(*this, result);
     }
 
@@ -283,6 +289,137 @@ namespace la {
         return result;
     }
 
+    ////////////////////////////////////////////
+    /// Reduction Column
+    template <typename number, typename timeunit>
+    constexpr int ReductionColumn<number,timeunit>::MIN_DENSE;
+
+    template <typename number, typename timeunit>
+    constexpr int ReductionColumn<number,timeunit>::DENSE_RATIO;
+
+    template <typename number, typename timeunit>
+    ReductionColumn<number,timeunit>::ReductionColumn(const int& dim, const int& threshold):
+        sparse(dim),
+        scratch(dim),
+        dense_threshold(threshold > 0 ? threshold : std::max(MIN_DENSE, dim / DENSE_RATIO)),
+        sparse_threshold(std::max(1, dense_threshold / 4)) {}
+
+    template <typename number, typename timeunit>
+    void ReductionColumn<number,timeunit>::load(Vec&& col) {
+        ASSERT(col.dim() == sparse.dim());
+        // the previous column might not have been stored (i.e. solve threw)
+        if (is_dense) { gather(); }
+        std::swap(sparse.vect, col.vect);
+        col.vect.clear();
+
+        if (int(sparse.size()) > dense_threshold) { scatter(); }
+    }
+
+    template <typename number, typename timeunit>
+    void ReductionColumn<number,timeunit>::store(Vec& col) {
+        if (is_dense) { gather(); }
+
+        col.dimension = sparse.dim();
+        col.vect.clear();
+        std::swap(col.vect, sparse.vect);
+    }
+
+    template <typename number, typename timeunit>
+    number ReductionColumn<number,timeunit>::pivot() const {
+        DEBUG_ASSERT(!isZero());
+        return is_dense ? dense[pivot_dim] : sparse.pivot();
+    }
+
+    template <typename number, typename timeunit>
+    void ReductionColumn<number,timeunit>::addMultiple(const Vec& vec, const number& k) {
+        ASSERT(vec.dim() == sparse.dim());
+        STATS_ADD(column_additions, 1);
+
+        if (!is_dense) {
+            sparse.add(vec, k, scratch);
+
+            STATS_ADD(fill_in, std::max<long>(0, long(scratch.size()) - long(sparse.size())));
+            STATS_MAX(peak_column_length, scratch.size());
+            STATS_ADD(allocations, scratch.vect.capacity() < sparse.size() + vec.size() ? 1 : 0);
+
+            std::swap(sparse.vect, scratch.vect);
+            if (int(sparse.size()) > dense_threshold) { scatter(); }
+            return;
+        }
+
+        for (const SparseEntry& entry : vec.vect) {
+            number& val = dense[entry.first];
+            const bool was_zero = val == 0;
+            val = val + k*entry.second;
+
+            if (was_zero) {
+                if (val != 0) { ++nonzeros; STATS_ADD(fill_in, 1); }
+            }
+            else if (val == 0) {
+                --nonzeros;
+            }
+        }
+        STATS_MAX(peak_column_length, nonzeros);
+
+        // the pivot only moves up if vec has a higher one
+        if (!vec.isZero()) { pivot_dim = std::max(pivot_dim, vec.pivotDim()); }
+        while (pivot_dim >= 0 && dense[pivot_dim] == 0) { --pivot_dim; }
+
+        if (nonzeros < sparse_threshold) { gather(); }
+    }
+
+    template <typename number, typename timeunit>
+    void ReductionColumn<number,timeunit>::reduce(Vec& col, const std::vector<int>& pivot_cols,
+            const std::vector<Vec>& columns) {
+        // columns which are already reduced do not need to go through the work column
+        if (col.isZero() || pivot_cols[col.pivotDim()] == -1) { return; }
+
+        load(std::move(col));
+        while (!isZero()) {
+            const int eliminatorN = pivot_cols[pivotDim()];
+            if (eliminatorN == -1) { break; }
+
+            const Vec& eliminator = columns[eliminatorN];
+            addMultiple(eliminator, -pivot() * eliminator.pivot().inverse());
+        }
+        store(col);
+    }
+
+    template <typename number, typename timeunit>
+    void ReductionColumn<number,timeunit>::scatter() {
+        if (dense.empty()) {
+            dense.assign(sparse.dim(), number(0));
+            STATS_ADD(allocations, 1);
+        }
+
+        for (const SparseEntry& entry : sparse.vect) {
+            dense[entry.first] = entry.second;
+        }
+        nonzeros = sparse.size();
+        pivot_dim = sparse.pivotDim();
+        sparse.vect.clear();
+        is_dense = true;
+    }
+
+    template <typename number, typename timeunit>
+    void ReductionColumn<number,timeunit>::gather() {
+        // collect the entries from the pivot down, so the scan stops at the lowest one
+        sparse.vect.clear();
+        sparse.vect.reserve(nonzeros);
+        for (int dimN = pivot_dim; int(sparse.size()) < nonzeros; dimN--) {
+            DEBUG_ASSERT(dimN >= 0);
+            if (dense[dimN] != 0) {
+                sparse.vect.push_back({ dimN, dense[dimN] });
+                dense[dimN] = 0;
+            }
+        }
+        std::reverse(sparse.vect.begin(), sparse.vect.end());
+
+        nonzeros = 0;
+        pivot_dim = -1;
+        is_dense = false;
+    }
+
     ////////////////////////////////////////////
     /// Matrix Entry
     template <typename number,typename timeunit>
@@ -498,7 +635,11 @@ namespace la {
     Matrix<number,timeunit>::Matrix(const Mat& other):
         mat(other.mat),
         row_times(other.row_times),
-        col_times(other.col_times) {}
+        col_times(other.col_times),
+        row_mask(other.row_mask),
+        col_mask(other.col_mask),
+        masked_rows(other.masked_rows),
+        masked_cols(other.masked_cols) {}
 
     template <typename number,typename timeunit>
     Matrix<number,timeunit>& Matrix<number,timeunit>::operator =(const Mat& other) {
@@ -512,7 +653,11 @@ namespace la {
     Matrix<number,timeunit>::Matrix(Mat&& other):
         mat(std::move(other.mat)),
         row_times(std::move(other.row_times)),
-        col_times(std::move(other.col_times)) {}
+        col_times(std::move(other.col_times)),
+        row_mask(std::move(other.row_mask)),
+        col_mask(std::move(other.col_mask)),
+        masked_rows(std::move(other.masked_rows)),
+        masked_cols(std::move(other.masked_cols)) {}
 
     template <typename number,typename timeunit>
     Matrix<number,timeunit>& Matrix<number,timeunit>::operator =(Mat&& other) {
@@ -520,6 +665,10 @@ namespace la {
             std::swap(mat, other.mat);
             std::swap(row_times, other.row_times);
             std::swap(col_times, other.col_times);
+            std::swap(row_mask, other.row_mask);
+            std::swap(col_mask, other.col_mask);
+            std::swap(masked_rows, other.masked_rows);
+            std::swap(masked_cols, other.masked_cols);
         }
         return *this;
     }
@@ -527,8 +676,12 @@ namespace la {
     template <typename number,typename timeunit>
     bool Matrix<number,timeunit>::operator ==(const Mat& other) const {
         if (rows() != other.rows() || cols() != other.cols()) { return false; }
+        const bool masked = hasMasks() || other.hasMasks();
         for (int col_n = 0; col_n < cols(); col_n++) {
-            if (mat[col_n] != other.mat[col_n]) { return false; }
+            if (masked) {
+                if (maskedColumn(col_n) != other.maskedColumn(col_n)) { return false; }
+            }
+            else if (mat[col_n] != other.mat[col_n]) { return false; }
         }
         return row_times == other.row_times && col_times == other.col_times;
     }
@@ -542,6 +695,9 @@ namespace la {
     typename Matrix<number,timeunit>::Entry Matrix<number,timeunit>::operator () (const int& rowN, const int& colN) const {
         DEBUG_ASSERT(0 <= rowN && rowN < rows());
         DEBUG_ASSERT(0 <= colN && colN < cols());
+        if (isRowMasked(rowN) || isColMasked(colN)) {
+            return { 0, getEntryTime(rowN, colN) };
+        }
         return { mat[colN][rowN], getEntryTime(rowN, colN) };
     }
 
@@ -565,6 +721,7 @@ namespace la {
     template <typename number,typename timeunit>
     VectorWrapper<number,timeunit> Matrix<number,timeunit>::operator [](const int& colN) const {
         DEBUG_ASSERT(0 <= colN && colN < cols());
+        ASSERT(!hasMasks());
         return VectorWrapper<number,timeunit>(mat[colN], row_times, col_times[colN]);
     }
 
@@ -584,7 +741,7 @@ namespace la {
 
         const int col_dim = cols();
         for (int colN = 0; colN < col_dim; colN++) {
-            const int pivot_dim = mat[colN].pivotDim();
+            const int pivot_dim = maskedPivotDim(colN);
             if (pivot_dim == -1) { continue; }  // zero column
             if (pivot_rows[pivot_dim]) { return false; }
             pivot_rows[pivot_dim] = true;
@@ -619,32 +776,76 @@ namespace la {
 
         for (timeunit& step : row_times) { step = 0; }
         for (timeunit& step : col_times) { step = 0; }
+
+        row_mask.clear();   masked_rows.clear();
+        col_mask.clear();   masked_cols.clear();
     }
 
     template <typename number,typename timeunit>
     void Matrix<number,timeunit>::reduce(const bool& del_zeros) {
+        // the columns get rewritten anyway
+        if (hasMasks()) { applyMasks(); }
+
+        std::vector<int> pivot_cols(rows(), -1);
+        ReductionColumn<number,timeunit> work(rows());
+
+        int outN = 0;
         for (int colN = 0; colN < cols(); colN++) {
             Vec& curr_col = mat[colN];
-            bool change = true;
-
-            while (!curr_col.isZero() && change) {
-                change = false;
-                const int pivot_dim = curr_col.pivotDim();
-
-                for (int eliminatorN = colN-1; eliminatorN >= 0; eliminatorN--) {
-                    const Vec& eliminator = mat[eliminatorN];
-                    if (eliminator.pivotDim() == pivot_dim) {
-                        curr_col.addMultiple(eliminator, 1 / eliminator.pivot());
-                        change = true;
-                        break;
-                    }
-                }
+            reduceColumn(curr_col, pivot_cols, work);
+
+            if (del_zeros && curr_col.isZero()) { continue; }
+            if (!curr_col.isZero()) {
+                pivot_cols[curr_col.pivotDim()] = outN;
             }
+            if (outN != colN) {
+                mat[outN] = std::move(curr_col);
+                col_times[outN] = col_times[colN];
+            }
+            ++outN;
+        }
 
-            if (del_zeros && curr_col.isZero()) {
-                mat.erase(mat.begin() + colN);
-                col_times.erase(col_times.begin() + colN);
-                --colN;
+        mat.erase(mat.begin() + outN, mat.end());
+        col_times.erase(col_times.begin() + outN, col_times.end());
+    }
+
+    template <typename number,typename timeunit>
+    void Matrix<number,timeunit>::mergeReduced(const Mat& other, const number& k, Mat& result) const {
+        ASSERT(row_times == other.row_times);
+        DEBUG_ASSERT(&result != this && &result != &other);
+
+        const int cols_a = cols();
+        const int cols_b = other.cols();
+
+        result = Mat(rows(), 0, row_times, {});
+        result.mat.reserve(cols_a + cols_b);
+        result.col_times.reserve(cols_a + cols_b);
+
+        std::vector<int> pivot_cols(rows(), -1);
+        ReductionColumn<number,timeunit> work(rows());
+
+        // the column is only reduced if its pivot was already taken by
+        // one of the previous columns
+        const auto append = [&](Vec& col, const timeunit& time) {
+            result.reduceColumn(col, pivot_cols, work);
+            if (col.isZero()) { return; }
+
+            pivot_cols[col.pivotDim()] = result.mat.size();
+            result.mat.push_back(std::move(col));
+            result.col_times.push_back(time);
+        };
+
+        int i = 0, j = 0;
+        while (i < cols_a || j < cols_b) {
+            if (j == cols_b || (i < cols_a && col_times[i] <= other.col_times[j])) {
+                Vec col = maskedColumn(i);
+                append(col, col_times[i]);
+                ++i;
+            }
+            else {
+                Vec col(other.mat[j].dim());    col.addMultiple(other.maskedColumn(j), k);
+                append(col, other.col_times[j]);
+                ++j;
             }
         }
     }
@@ -660,7 +861,10 @@ namespace la {
 
         // index this by rows, so it will be easier to multiply
         SparseMatrix A_rows;    transpose(A_rows);
-        const SparseMatrix B_cols = B.mat;
+        SparseMatrix B_cols;    B_cols.reserve(out_cols);
+        for (int col_n = 0; col_n < out_cols; col_n++) {
+            B_cols.push_back(B.maskedColumn(col_n));
+        }
 
         SparseMatrix& C_cols = C.mat;
 
@@ -690,56 +894,118 @@ namespace la {
         // entries in 'vec'
         for (size_t entryN = 0; entryN < internal_vec.vect.size(); entryN++) {
             const SparseEntry& entry = internal_vec.vect[entryN];
-            result_vec.addMultiple(mat[entry.first], entry.second);
+            if (hasMasks()) {
+                result_vec.addMultiple(maskedColumn(entry.first), entry.second);
+            }
+            else {
+                result_vec.addMultiple(mat[entry.first], entry.second);
+            }
         }
     }
 
     template <typename number,typename timeunit>
     void Matrix<number,timeunit>::decompose(Mat& kernel, Mat& image) const {
+        decompose(kernel, image, {});
+    }
+
+    template <typename number,typename timeunit>
+    void Matrix<number,timeunit>::decompose(Mat& kernel, Mat& image, const std::vector<int>& trivial_cols) const {
+        decompose(kernel, image, trivial_cols, {});
+    }
+
+    template <typename number,typename timeunit>
+    void Matrix<number,timeunit>::decompose(Mat& kernel, Mat& image, const std::vector<int>& trivial_cols,
+            const std::vector<std::pair<int,int>>& apparent_pairs) const {
+        STATS_PHASE(Decompose);
+
         const int col_dim = cols();
         // copy the rows of this matrix into the image and perform gaussian elimination
-        image = *this;
+        copyMasked(image);
 
         Mat op_follower;    op_follower.make_identity(col_dim);
 
+        std::vector<bool> trivial(col_dim, false);
+        for (const int& colN : trivial_cols) {
+            ASSERT(0 <= colN && colN < col_dim);
+            trivial[colN] = true;
+        }
+
+        // apparent_cofacet[facet] is the column whose boundary is the facet's cycle
+        std::vector<int> apparent_cofacet(col_dim, -1);
+        for (const std::pair<int,int>& pair : apparent_pairs) {
+            ASSERT(rows() == col_dim);
+            ASSERT(0 <= pair.first && pair.first < pair.second && pair.second < col_dim);
+            if (!trivial[pair.first] && !trivial[pair.second]) {
+                apparent_cofacet[pair.first] = pair.second;
+            }
+        }
+
         // use gaussian elimination, to eliminate as many columns as possible
         // the ones that cannot be eliminated are in the image
         // assume a certain structure:
         // columns with lower indexes do not have pivots in rows with higher indexes
         // once a pivot is found in row k, a new one cannot appear in rows < k
 
+        // the long columns are reduced in a dense representation (see ReductionColumn)
         SparseMatrix& im = image.mat;
+        std::vector<int> pivot_cols(rows(), -1);
+        ReductionColumn<number,timeunit> curr_col(rows());
+        ReductionColumn<number,timeunit> follower(col_dim);
         int kernel_cols = 0;
         for (int colN = 0; colN < col_dim; colN++) {
-            Vec& curr_col = im[colN];
-            bool change = true;
-
-            while (!curr_col.isZero() && change) {
-                change = false;
-                const int pivot_dim = curr_col.pivotDim();
-
-                for (int eliminatorN = colN-1; eliminatorN >= 0; eliminatorN--) {
-                    const Vec& eliminator = im[eliminatorN];
-                    if (eliminator.pivotDim() == pivot_dim) {
-                        const number pivot_inv = eliminator.pivot().inverse();
-                        curr_col.addMultiple(eliminator, pivot_inv);
-                        op_follower.mat[colN].addMultiple(op_follower.mat[eliminatorN], pivot_inv);
-                        change = true;
-                        break;
-                    }
+            if (trivial[colN]) {
+                im[colN].makeZero();
+                continue;
+            }
+            if (apparent_cofacet[colN] != -1) {
+                // the cofacet is not processed yet, so its column is still the boundary
+                const Vec& cofacet = im[apparent_cofacet[colN]];
+                const number inv = cofacet.pivot().inverse();
+
+                Vec& cycle = op_follower.mat[colN];
+                cycle.vect.clear();
+                for (const SparseEntry& entry : cofacet.vect) {
+                    cycle.vect.push_back({ entry.first, inv * entry.second });
                 }
+                im[colN].makeZero();
+                ++kernel_cols;
+
+                STATS_ADD(apparent_pairs, 1);
+                continue;
             }
+            if (im[colN].isZero() || pivot_cols[im[colN].pivotDim()] == -1) {
+                if (im[colN].isZero()) { ++kernel_cols; }
+                else { pivot_cols[im[colN].pivotDim()] = colN; }
+                continue;
+            }
+
+            curr_col.load(std::move(im[colN]));
+            follower.load(std::move(op_follower.mat[colN]));
+            while (!curr_col.isZero()) {
+                const int eliminatorN = pivot_cols[curr_col.pivotDim()];
+                if (eliminatorN == -1) { break; }
 
-            if (curr_col.isZero()) {
+                const Vec& eliminator = im[eliminatorN];
+                const number factor = -curr_col.pivot() * eliminator.pivot().inverse();
+                curr_col.addMultiple(eliminator, factor);
+                follower.addMultiple(op_follower.mat[eliminatorN], factor);
+            }
+            curr_col.store(im[colN]);
+            follower.store(op_follower.mat[colN]);
+
+            if (im[colN].isZero()) {
                 ++kernel_cols;
             }
+            else {
+                pivot_cols[im[colN].pivotDim()] = colN;
+            }
         }
 
         // construct the kernel
         kernel.resize(col_dim, kernel_cols);
         int kernel_col = 0;
         for (int colN = 0; colN < col_dim; colN++) {
-            if (image[colN].isZero()) {
+            if (!trivial[colN] && im[colN].isZero()) {
                 kernel.mat[kernel_col] = std::move(op_follower.mat[colN]);
                 kernel.col_times[kernel_col] = image.col_times[colN];
                 ++kernel_col;
@@ -759,8 +1025,41 @@ namespace la {
         im.erase(last, im.end());
     }
 
+    template <typename number,typename timeunit>
+    void Matrix<number,timeunit>::apparentPairs(std::vector<std::pair<int,int>>& pairs) const {
+        ASSERT(rows() == cols());
+        pairs.clear();
+
+        // the first (oldest) column containing each row
+        std::vector<int> first_cofacet(rows(), -1);
+        for (int colN = 0; colN < cols(); colN++) {
+            if (isColMasked(colN)) { continue; }
+            for (const SparseEntry& entry : mat[colN].vect) {
+                if (first_cofacet[entry.first] == -1 && !isRowMasked(entry.first)) {
+                    first_cofacet[entry.first] = colN;
+                }
+            }
+        }
+
+        for (int colN = 0; colN < cols(); colN++) {
+            if (isColMasked(colN)) { continue; }
+            const int facetN = maskedPivotDim(colN);
+            if (facetN != -1 && first_cofacet[facetN] == colN) {
+                pairs.push_back({ facetN, colN });
+            }
+        }
+    }
+
     template <typename number,typename timeunit>
     void Matrix<number,timeunit>::solve(const Mat& B, Mat& X) const {
+        STATS_PHASE(Solve);
+
+        if (hasMasks()) {
+            Mat A;  copyMasked(A);
+            A.solve(B, X);
+            return;
+        }
+
         ASSERT(isReducedForm());
         ASSERT(row_times == B.row_times);
 
@@ -769,33 +1068,33 @@ namespace la {
 
         X.resize(dimA, dimB, col_times, B.col_times);
 
+        // index the columns of A by their pivots (they are unique in reduced form)
+        std::vector<int> pivot_cols(rows(), -1);
+        for (int colN = 0; colN < dimA; colN++) {
+            if (!mat[colN].isZero()) {
+                pivot_cols[mat[colN].pivotDim()] = colN;
+            }
+        }
+
+        ReductionColumn<number,timeunit> bvec(rows());
         for (int vecN = 0; vecN < dimB; vecN++) {
             // find a linear combination of vectors in A which produce b (i.e. A*alpha = b)
             // alpha then represents the current column of X
 
             // copy B's current vector, so you can modify it
-            Vec bvec = B.mat[vecN];
+            bvec.load(B.maskedColumn(vecN));
             typename Vec::vector alpha_rev;   // will hold the tuples that go into alpha in reverse order
 
             while (!bvec.isZero()) {
-                const int pivot_dim = bvec.pivotDim();
-                const number& pivot = bvec.pivot();
-
-                bool found_elim = false;
-                for (int eliminatorN = 0; eliminatorN < dimA; eliminatorN++) {
-                    const Vec& elim = mat[eliminatorN];
-                    if (elim.pivotDim() == pivot_dim) {
-                        const number factor = pivot * elim.pivot().inverse();
-                        bvec.addMultiple(elim, -factor);
-                        alpha_rev.push_back({ eliminatorN, factor });
-                        found_elim = true;
-                        break;
-                    }
-                }
-
-                if (!found_elim) {
+                const int eliminatorN = pivot_cols[bvec.pivotDim()];
+                if (eliminatorN == -1) {
                     throw except::NotInImageSpaceException("Could not find a combination for the " + std::to_string(vecN) + "-th vector!");
                 }
+
+                const Vec& elim = mat[eliminatorN];
+                const number factor = bvec.pivot() * elim.pivot().inverse();
+                bvec.addMultiple(elim, -factor);
+                alpha_rev.push_back({ eliminatorN, factor });
             }
 
             // reverse the vector and put it into X (this implementation relies on move semantics)
@@ -825,28 +1124,113 @@ namespace la {
         transposed.resize(rows(), Vec(cols()));
 
         for (int col_n = 0; col_n < cols(); col_n++) {
+            if (isColMasked(col_n)) { continue; }
             const std::vector<SparseEntry>& col = mat[col_n].vect;
 
             for (size_t entry_n = 0; entry_n < col.size(); entry_n++) {
                 const SparseEntry& entry = col[entry_n];
+                if (isRowMasked(entry.first)) { continue; }
                 transposed[entry.first].vect.push_back({ col_n, entry.second });
             }
         }
     }
 
+    template <typename number,typename timeunit>
+    void Matrix<number,timeunit>::reduceColumn(Vec& col, const std::vector<int>& pivot_cols,
+            ReductionColumn<number,timeunit>& work) const {
+        work.reduce(col, pivot_cols, mat);
+    }
+
     template <typename number, typename timeunit>
     void Matrix<number,timeunit>::zeroColumns(const std::vector<int>& column_idxs) {
+        // the cols added since the last call are unmasked, the old masks stay
+        if (col_mask.size() < size_t(cols())) { col_mask.resize(cols(), false); }
+
         for (const int& colN : column_idxs) {
             ASSERT(0 <= colN && colN < cols());
-            mat[colN].makeZero();
+            if (!col_mask[colN]) {
+                col_mask[colN] = true;
+                masked_cols.push_back(colN);
+            }
         }
     }
 
     template <typename number, typename timeunit>
     void Matrix<number,timeunit>::zeroRows(const std::vector<int>& row_idxs) {
+        // the rows added since the last call are unmasked, the old masks stay
+        if (row_mask.size() < size_t(rows())) { row_mask.resize(rows(), false); }
+
+        for (const int& rowN : row_idxs) {
+            ASSERT(0 <= rowN && rowN < rows());
+            if (!row_mask[rowN]) {
+                row_mask[rowN] = true;
+                masked_rows.push_back(rowN);
+            }
+        }
+    }
+
+    template <typename number, typename timeunit>
+    void Matrix<number,timeunit>::clearMasks() {
+        for (const int& rowN : masked_rows) { row_mask[rowN] = false; }
+        for (const int& colN : masked_cols) { col_mask[colN] = false; }
+        masked_rows.clear();
+        masked_cols.clear();
+    }
+
+    template <typename number, typename timeunit>
+    void Matrix<number,timeunit>::applyMasks() {
+        if (!hasMasks()) { return; }
+
         const int n_cols = cols();
         for (int colN = 0; colN < n_cols; colN++) {
-            mat[colN].setZero(row_idxs);
+            if (isColMasked(colN)) {
+                mat[colN].makeZero();
+            }
+            else if (!masked_rows.empty()) {
+                typename Vec::vector& col = mat[colN].vect;
+                col.erase(std::remove_if(col.begin(), col.end(),
+                        [&](const SparseEntry& entry) { return isRowMasked(entry.first); }), col.end());
+            }
+        }
+        clearMasks();
+    }
+
+    template <typename number, typename timeunit>
+    Vector<number,timeunit> Matrix<number,timeunit>::maskedColumn(const int& colN) const {
+        const Vec& col = mat[colN];
+        if (isColMasked(colN)) { return Vec(col.dim()); }
+        if (masked_rows.empty()) { return col; }
+
+        Vec result(col.dim());
+        result.vect.reserve(col.vect.size());
+        for (const SparseEntry& entry : col.vect) {
+            if (!isRowMasked(entry.first)) { result.vect.push_back(entry); }
+        }
+        return result;
+    }
+
+    template <typename number, typename timeunit>
+    int Matrix<number,timeunit>::maskedPivotDim(const int& colN) const {
+        if (isColMasked(colN)) { return -1; }
+
+        const typename Vec::vector& col = mat[colN].vect;
+        for (auto entry_ptr = col.rbegin(); entry_ptr != col.rend(); ++entry_ptr) {
+            if (!isRowMasked(entry_ptr->first)) { return entry_ptr->first; }
+        }
+        return -1;
+    }
+
+    template <typename number, typename timeunit>
+    void Matrix<number,timeunit>::copyMasked(Mat& dest) const {
+        if (!hasMasks()) {
+            dest = *this;
+            return;
+        }
+
+        dest = Mat(rows(), 0, row_times, col_times);
+        dest.mat.reserve(cols());
+        for (int colN = 0; colN < cols(); colN++) {
+            dest.mat.push_back(maskedColumn(colN));
         }
     }
 
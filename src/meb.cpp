@@ -0,0 +1 @@
+#include "meb.h"
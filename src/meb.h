@@ -0,0 +1,94 @@
+#ifndef _MEB_H
+#define _MEB_H
+
+#include <array>
+#include <limits>
+
+#include "except.h"
+
+/// Smallest enclosing balls of small point sets. The sets of up to 4 points
+/// (the edges, triangles and tetrahedra of a Delaunay complex) have closed
+/// form kernels, the larger ones go to the fixed dimension Miniball below.
+namespace meb {
+
+    /// Gaertner's pivoting move-to-front algorithm (as in Miniball.h) for a
+    /// dimension known at compile time. All the workspace is inline, the support
+    /// set holds at most D+2 points and nothing is timed, so a solver can be kept
+    /// around and reused for any number of point sets without allocating.
+    template <int D, typename NT = double>
+    class Miniball {
+    public:
+        Miniball();
+
+        /// computes the smallest enclosing ball of the k points (D coordinates
+        /// each) and returns its squared radius
+        NT compute(const NT* const* points, const int& k);
+        /// the squared radii of count point sets with k points each,
+        /// simplices[i*k + j] is the index of the j-th point of the i-th set in
+        /// the N x D coordinate buffer coords
+        void compute(const NT* coords, const int* simplices, const int& k, const int& count, NT* out);
+
+        /// the ball of the last computation
+        const NT* center() const { return c[current]; }
+        NT squared_radius() const { return current_sqr_r; }
+        int nr_support_points() const { return ssize; }
+
+    private:
+        void mtf_mb(const int n);
+        void mtf_move_to_front(const int& j);
+        void pivot_mb(const int& n);
+        void pivot_move_to_front(const NT* p);
+        NT excess(const NT* p) const;
+        bool push(const NT* p);
+        void pop() { --fsize; }
+
+        // the input
+        const NT* const* points;
+
+        // the move-to-front list, only its first support_end entries are ever
+        // looked at again
+        const NT* L[D+2];
+        int support_end;
+        int fsize;      // number of forced points
+        int ssize;      // number of support points
+
+        // the balls of the forced points
+        int current;
+        NT current_sqr_r;
+        NT c[D+1][D];
+        NT sqr_r[D+1];
+
+        NT q0[D];
+        NT z[D+1];
+        NT f[D+1];
+        NT v[D+1][D];
+        NT a[D+1][D];
+    };
+
+    /// squared radius of the smallest ball enclosing the k points in R^D. The edges
+    /// and the triangles are never below their faces, the larger simplices can round
+    /// below them (filtration::cechComplex raises them to their facets).
+    template <int D>
+    double squaredRadius(const double* const* points, const int& k);
+
+    /// the kernels for a fixed number of points
+    template <int D> double squaredRadius2(const double* a, const double* b);
+    template <int D> double squaredRadius3(const double* a, const double* b, const double* c);
+    template <int D> double squaredRadius4(const double* a, const double* b, const double* c, const double* d);
+
+    /// squared radius of the smallest sphere through all the k points (k <= D+1),
+    /// its center lies in their affine hull and is written to center, returns
+    /// infinity if the points are affinely dependent
+    template <int D>
+    double circumsphere(const double* const* points, const int& k, double* center);
+
+    /// squared radii of count simplices with K vertices each, simplices[i*K + j] is
+    /// the index of the j-th vertex of the i-th simplex in the N x D coordinate
+    /// buffer coords, the results are written to out[0..count)
+    template <int D, int K>
+    void squaredRadii(const double* coords, const int* simplices, const int& count, double* out);
+}
+
+#include "meb.hpp"
+
+#endif
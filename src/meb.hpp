@@ -0,0 +1,402 @@
+#include <cmath>
+#include <algorithm>
+
+namespace meb {
+
+    template <int D, typename NT>
+    Miniball<D,NT>::Miniball():
+        points(nullptr),
+        support_end(0),
+        fsize(0),
+        ssize(0),
+        current(0),
+        current_sqr_r(-1) {}
+
+    template <int D, typename NT>
+    NT Miniball<D,NT>::compute(const NT* const* points_, const int& k) {
+        ASSERT(k > 0);
+        points = points_;
+        support_end = 0;
+        fsize = 0;
+        ssize = 0;
+
+        for (int j = 0; j < D; j++) { c[0][j] = NT(0); }
+        current = 0;
+        current_sqr_r = NT(-1);
+
+        pivot_mb(k);
+        return current_sqr_r;
+    }
+
+    template <int D, typename NT>
+    void Miniball<D,NT>::compute(const NT* coords, const int* simplices, const int& k, const int& count, NT* out) {
+        ASSERT(k <= D+1);
+        const NT* simplex[D+1];
+        for (int simplexN = 0; simplexN < count; simplexN++) {
+            for (int j = 0; j < k; j++) { simplex[j] = coords + D*simplices[simplexN*k + j]; }
+            out[simplexN] = compute(simplex, k);
+        }
+    }
+
+    template <int D, typename NT>
+    void Miniball<D,NT>::mtf_mb(const int n) {
+        // the ball of the forced points is the current one, find the support
+        // points among the first n of the list (n is taken by value, it is
+        // support_end for the outermost call)
+        support_end = 0;
+        if (fsize == D+1) { return; }
+
+        for (int i = 0; i < n;) {
+            const int j = i++;
+            if (excess(L[j]) > NT(0) && push(L[j])) {
+                mtf_mb(j);
+                pop();
+                mtf_move_to_front(j);
+            }
+        }
+    }
+
+    template <int D, typename NT>
+    void Miniball<D,NT>::mtf_move_to_front(const int& j) {
+        // the list entries keep their identity, so the end of the support moves
+        // with the entries shifted behind the front
+        if (support_end <= j) { support_end++; }
+        const NT* p = L[j];
+        for (int i = j; i > 0; i--) { L[i] = L[i-1]; }
+        L[0] = p;
+    }
+
+    template <int D, typename NT>
+    void Miniball<D,NT>::pivot_mb(const int& n) {
+        NT old_sqr_r;
+        do {
+            old_sqr_r = current_sqr_r;
+
+            // the point furthest outside the current ball
+            const NT* pivot = points[0];
+            NT max_e = NT(0);
+            for (int k = 0; k < n; k++) {
+                const NT e = excess(points[k]);
+                if (e > max_e) {
+                    max_e = e;
+                    pivot = points[k];
+                }
+            }
+
+            if (max_e > NT(0) && std::find(L, L + support_end, pivot) == L + support_end) {
+                if (push(pivot)) {
+                    mtf_mb(support_end);
+                    pop();
+                    pivot_move_to_front(pivot);
+                }
+            }
+        } while (old_sqr_r < current_sqr_r);
+    }
+
+    template <int D, typename NT>
+    void Miniball<D,NT>::pivot_move_to_front(const NT* p) {
+        // the entries behind the support are dead, so D+2 of them are enough
+        for (int i = std::min(support_end, D+1); i > 0; i--) { L[i] = L[i-1]; }
+        L[0] = p;
+        support_end = std::min(support_end + 1, D+1);
+    }
+
+    template <int D, typename NT>
+    inline NT Miniball<D,NT>::excess(const NT* p) const {
+        NT e = -current_sqr_r;
+        for (int i = 0; i < D; i++) {
+            const NT diff = p[i] - c[current][i];
+            e += diff*diff;
+        }
+        return e;
+    }
+
+    template <int D, typename NT>
+    bool Miniball<D,NT>::push(const NT* p) {
+        if (fsize == 0) {
+            for (int i = 0; i < D; i++) {
+                q0[i] = p[i];
+                c[0][i] = p[i];
+            }
+            sqr_r[0] = NT(0);
+        }
+        else {
+            // v_fsize is the part of p - q0 orthogonal to the previous v_i
+            for (int i = 0; i < D; i++) { v[fsize][i] = p[i] - q0[i]; }
+            for (int i = 1; i < fsize; i++) {
+                a[fsize][i] = NT(0);
+                for (int j = 0; j < D; j++) { a[fsize][i] += v[i][j] * v[fsize][j]; }
+                a[fsize][i] *= 2 / z[i];
+            }
+            for (int i = 1; i < fsize; i++) {
+                for (int j = 0; j < D; j++) { v[fsize][j] -= a[fsize][i] * v[i][j]; }
+            }
+
+            z[fsize] = NT(0);
+            for (int j = 0; j < D; j++) { z[fsize] += v[fsize][j] * v[fsize][j]; }
+            z[fsize] *= 2;
+
+            // p is (almost) in the affine hull of the forced points
+            const NT eps = std::numeric_limits<NT>::epsilon() * std::numeric_limits<NT>::epsilon();
+            if (z[fsize] < eps * current_sqr_r) { return false; }
+
+            NT e = -sqr_r[fsize-1];
+            for (int i = 0; i < D; i++) {
+                const NT diff = p[i] - c[fsize-1][i];
+                e += diff*diff;
+            }
+            f[fsize] = e / z[fsize];
+
+            for (int i = 0; i < D; i++) { c[fsize][i] = c[fsize-1][i] + f[fsize] * v[fsize][i]; }
+            sqr_r[fsize] = sqr_r[fsize-1] + e * f[fsize] / 2;
+        }
+        current = fsize;
+        current_sqr_r = sqr_r[fsize];
+        ssize = ++fsize;
+        return true;
+    }
+
+    namespace detail {
+        // relative slack of the containment test, the true ball always passes it
+        // and a candidate which only passes because of it is within the slack anyway
+        constexpr double SLACK = 1e-10;
+
+        template <int D>
+        inline double sqDist(const double* a, const double* b) {
+            double dist = 0;
+            for (int i = 0; i < D; i++) {
+                const double diff = a[i] - b[i];
+                dist += diff*diff;
+            }
+            return dist;
+        }
+
+        // (a-o).(b-o)
+        template <int D>
+        inline double dot(const double* a, const double* b, const double* o) {
+            double prod = 0;
+            for (int i = 0; i < D; i++) {
+                prod += (a[i] - o[i]) * (b[i] - o[i]);
+            }
+            return prod;
+        }
+
+        template <int D>
+        inline bool contains(const double* center, const double& sq_radius, const double* p) {
+            return sqDist<D>(center, p) <= sq_radius * (1 + SLACK);
+        }
+
+        /// the circumball of the triangle, returns false if the circumcenter is
+        /// not inside the triangle (or the triangle is degenerate)
+        template <int D>
+        bool circumball3(const double* a, const double* b, const double* c, double* center, double& sq_radius) {
+            // solve the gram system of the edges from a for the barycentric coordinates
+            const double g11 = dot<D>(b, b, a);
+            const double g22 = dot<D>(c, c, a);
+            const double g12 = dot<D>(b, c, a);
+
+            const double det = g11*g22 - g12*g12;
+            if (!(det > std::numeric_limits<double>::epsilon() * g11*g22)) { return false; }
+
+            const double l1 = 0.5 * g22 * (g11 - g12) / det;
+            const double l2 = 0.5 * g11 * (g22 - g12) / det;
+            if (l1 < 0 || l2 < 0 || l1 + l2 > 1) { return false; }
+
+            for (int i = 0; i < D; i++) {
+                center[i] = a[i] + l1*(b[i] - a[i]) + l2*(c[i] - a[i]);
+            }
+            sq_radius = 0.5 * (l1*g11 + l2*g22);
+            return true;
+        }
+
+        /// the circumball of the tetrahedron, returns false if the circumcenter is
+        /// not inside the tetrahedron (or the tetrahedron is degenerate)
+        template <int D>
+        bool circumball4(const double* a, const double* b, const double* c, const double* d, double& sq_radius) {
+            const double g11 = dot<D>(b, b, a), g22 = dot<D>(c, c, a), g33 = dot<D>(d, d, a);
+            const double g12 = dot<D>(b, c, a), g13 = dot<D>(b, d, a), g23 = dot<D>(c, d, a);
+            const double r1 = 0.5*g11, r2 = 0.5*g22, r3 = 0.5*g33;
+
+            // cramer's rule on the symmetric 3x3 system
+            const double c11 = g22*g33 - g23*g23;
+            const double c12 = g13*g23 - g12*g33;
+            const double c13 = g12*g23 - g13*g22;
+            const double det = g11*c11 + g12*c12 + g13*c13;
+            if (!(det > std::numeric_limits<double>::epsilon() * g11*g22*g33)) { return false; }
+
+            const double c22 = g11*g33 - g13*g13;
+            const double c23 = g12*g13 - g11*g23;
+            const double c33 = g11*g22 - g12*g12;
+
+            const double l1 = (c11*r1 + c12*r2 + c13*r3) / det;
+            const double l2 = (c12*r1 + c22*r2 + c23*r3) / det;
+            const double l3 = (c13*r1 + c23*r2 + c33*r3) / det;
+            if (l1 < 0 || l2 < 0 || l3 < 0 || l1 + l2 + l3 > 1) { return false; }
+
+            sq_radius = l1*r1 + l2*r2 + l3*r3;
+            return true;
+        }
+
+        template <int D>
+        double miniball(const double* const* points, const int& k) {
+            // one solver per thread, it holds no state between the calls
+            thread_local Miniball<D> mb;
+            return mb.compute(points, k);
+        }
+    }
+
+    template <int D>
+    double squaredRadius2(const double* a, const double* b) {
+        return detail::sqDist<D>(a, b) / 4;
+    }
+
+    template <int D>
+    double squaredRadius3(const double* a, const double* b, const double* c) {
+        // the edges in increasing order, so the rounding does not depend on the order of the points
+        double ab = detail::sqDist<D>(a, b);
+        double bc = detail::sqDist<D>(b, c);
+        double ca = detail::sqDist<D>(c, a);
+        if (ab > bc) { std::swap(ab, bc); }
+        if (bc > ca) { std::swap(bc, ca); }
+        if (ab > bc) { std::swap(ab, bc); }
+
+        // a right or obtuse triangle is enclosed by the ball of its longest edge
+        // (this also covers the degenerate ones), it gets the same value as the edge
+        const double longest = std::max(ab, std::max(bc, ca));
+        if (2*longest >= ab + bc + ca) { return longest / 4; }
+
+        // R = |ab||bc||ca| / (4*area) and 16*area^2 = 2(ab*bc + bc*ca + ca*ab) - ab^2 - bc^2 - ca^2,
+        // a nearly right triangle could round below its longest edge
+        const double area16 = 2*(ab*bc + bc*ca + ca*ab) - ab*ab - bc*bc - ca*ca;
+        return std::max(longest / 4, ab*bc*ca / area16);
+    }
+
+    template <int D>
+    double squaredRadius4(const double* a, const double* b, const double* c, const double* d) {
+        double sq_radius;
+        if (detail::circumball4<D>(a, b, c, d, sq_radius)) { return sq_radius; }
+
+        // otherwise the ball is spanned by a face, the smallest face ball which
+        // encloses the remaining points is the one
+        const std::array<const double*,4> p = {{ a, b, c, d }};
+        double best = std::numeric_limits<double>::infinity();
+        double center[D];
+
+        // the triangles, the value of the face is the one of the triangle itself
+        for (int i = 0; i < 4; i++) {
+            const double* u = p[(i+1)&3];
+            const double* v = p[(i+2)&3];
+            const double* w = p[(i+3)&3];
+            if (detail::circumball3<D>(u, v, w, center, sq_radius) && detail::contains<D>(center, sq_radius, p[i])) {
+                best = std::min(best, squaredRadius3<D>(u, v, w));
+            }
+        }
+
+        // the edges
+        for (int i = 0; i < 4; i++) {
+            for (int j = i+1; j < 4; j++) {
+                sq_radius = squaredRadius2<D>(p[i], p[j]);
+                if (sq_radius >= best) { continue; }
+
+                for (int k = 0; k < D; k++) { center[k] = (p[i][k] + p[j][k]) / 2; }
+                bool encloses = true;
+                for (int k = 0; k < 4; k++) {
+                    if (k != i && k != j && !detail::contains<D>(center, sq_radius, p[k])) { encloses = false; }
+                }
+                if (encloses) { best = sq_radius; }
+            }
+        }
+
+        // cannot happen unless the input is nan
+        if (best == std::numeric_limits<double>::infinity()) {
+            return detail::miniball<D>(p.data(), 4);
+        }
+        return best;
+    }
+
+    template <int D>
+    double squaredRadius(const double* const* points, const int& k) {
+        ASSERT(k > 0);
+        switch (k) {
+            case 1: return 0;
+            case 2: return squaredRadius2<D>(points[0], points[1]);
+            case 3: return squaredRadius3<D>(points[0], points[1], points[2]);
+            case 4: return squaredRadius4<D>(points[0], points[1], points[2], points[3]);
+            default: return detail::miniball<D>(points, k);
+        }
+    }
+
+    template <int D>
+    double circumsphere(const double* const* points, const int& k, double* center) {
+        ASSERT(0 < k && k <= D+1);
+        const double* origin = points[0];
+        const int m = k-1;
+
+        // the gram system G*l = diag(G)/2 of the edges from the first point,
+        // solved by gaussian elimination with partial pivoting
+        double sys[D][D+1];
+        double scale = 0;
+        for (int i = 0; i < m; i++) {
+            for (int j = 0; j < m; j++) { sys[i][j] = detail::dot<D>(points[i+1], points[j+1], origin); }
+            sys[i][m] = sys[i][i] / 2;
+            scale = std::max(scale, sys[i][i]);
+        }
+
+        for (int col = 0; col < m; col++) {
+            int pivot = col;
+            for (int row = col+1; row < m; row++) {
+                if (std::abs(sys[row][col]) > std::abs(sys[pivot][col])) { pivot = row; }
+            }
+            if (!(std::abs(sys[pivot][col]) > 16 * std::numeric_limits<double>::epsilon() * scale)) {
+                return std::numeric_limits<double>::infinity();
+            }
+            std::swap(sys[col], sys[pivot]);
+
+            for (int row = col+1; row < m; row++) {
+                const double factor = sys[row][col] / sys[col][col];
+                for (int j = col; j <= m; j++) { sys[row][j] -= factor * sys[col][j]; }
+            }
+        }
+
+        double l[D];
+        for (int row = m-1; row >= 0; row--) {
+            double val = sys[row][m];
+            for (int j = row+1; j < m; j++) { val -= sys[row][j] * l[j]; }
+            l[row] = val / sys[row][row];
+        }
+
+        for (int i = 0; i < D; i++) {
+            center[i] = origin[i];
+            for (int j = 0; j < m; j++) { center[i] += l[j] * (points[j+1][i] - origin[i]); }
+        }
+        return detail::sqDist<D>(center, origin);
+    }
+
+    template <int D, int K>
+    void squaredRadii(const double* coords, const int* simplices, const int& count, double* out) {
+        static_assert(K > 0, "a simplex has at least one vertex");
+
+        const double* points[K];
+        for (int simplexN = 0; simplexN < count; simplexN++) {
+            for (int j = 0; j < K; j++) {
+                points[j] = coords + D * simplices[simplexN*K + j];
+            }
+            out[simplexN] = squaredRadius<D>(points, K);
+        }
+    }
+
+    // the common cases without the dispatch, so the loops can be vectorized
+    template <>
+    inline void squaredRadii<2,2>(const double* coords, const int* simplices, const int& count, double* out) {
+        for (int simplexN = 0; simplexN < count; simplexN++) {
+            out[simplexN] = squaredRadius2<2>(coords + 2*simplices[2*simplexN], coords + 2*simplices[2*simplexN+1]);
+        }
+    }
+
+    template <>
+    inline void squaredRadii<3,2>(const double* coords, const int* simplices, const int& count, double* out) {
+        for (int simplexN = 0; simplexN < count; simplexN++) {
+            out[simplexN] = squaredRadius2<3>(coords + 3*simplices[2*simplexN], coords + 3*simplices[2*simplexN+1]);
+        }
+    }
+}
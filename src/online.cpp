@@ -0,0 +1 @@
+#include "online.h"
@@ -0,0 +1,57 @@
+#ifndef _ONLINE_H
+#define _ONLINE_H
+
+#include <vector>
+
+#include "topology.h"
+#include "toprep.h"
+#include "stats.h"
+
+namespace toprep {
+
+    ////////////////////////////////////////
+    /// OnlineModule: the barcode of a filtration which only grows at its end (the
+    /// simplices arrive in the filtration order, see Complex::append). The reduced
+    /// boundary columns and their pivots are kept, so every new column is reduced
+    /// against the existing pivots and none of the old columns is touched again.
+    template <typename number,typename timeunit=tstep>
+    class OnlineModule {
+    private:
+        using Vec = la::Vector<number,timeunit>;
+
+        std::vector<Vec> columns;       // the reduced boundary columns
+        std::vector<int> pivot_cols;    // the column with the low in the row or -1
+        std::vector<timeunit> times;
+
+        int rows = 0;       // the dimension of the columns, doubled when the complex outgrows it
+        la::ReductionColumn<number,timeunit> work = la::ReductionColumn<number,timeunit>(0);
+
+        /// reduces the column against the existing pivots and stores it
+        void push(Vec&& column, const timeunit& time);
+
+    public:
+        using time_type = timeunit;
+        using val_type = number;
+
+        OnlineModule() = default;
+        /// reduces the boundary of the finalized complex
+        template <typename indextype>
+        explicit OnlineModule(const top::Complex<timeunit,indextype>& C);
+
+        /// reduces the simplices appended to the complex since the last call (the
+        /// complex has to be the same one, only grown)
+        template <typename indextype>
+        void extend(const top::Complex<timeunit,indextype>& C);
+
+        /// the barcode of the filtration so far, a bar for every positive simplex in
+        /// the order of the filtration (as Module::getBarcode)
+        void getBarcode(std::vector<std::pair<timeunit,timeunit>>&) const;
+
+        /// the number of simplices reduced so far
+        int size() const { return columns.size(); }
+    };
+}
+
+#include "online.hpp"
+
+#endif
@@ -0,0 +1,64 @@
+#include <algorithm>
+
+namespace toprep {
+
+    template <typename number,typename timeunit>
+    template <typename indextype>
+    OnlineModule<number,timeunit>::OnlineModule(const top::Complex<timeunit,indextype>& C) {
+        extend(C);
+    }
+
+    template <typename number,typename timeunit>
+    template <typename indextype>
+    void OnlineModule<number,timeunit>::extend(const top::Complex<timeunit,indextype>& C) {
+        STATS_PHASE(Decompose);
+        ASSERT(C.is_finalized());
+        ASSERT(size() <= C.size());
+
+        columns.reserve(C.size());
+        pivot_cols.resize(C.size(), -1);
+        times.reserve(C.size());
+
+        // all the columns have the same dimension, it grows geometrically so the
+        // columns are only touched again for a logarithmic number of extensions
+        if (rows < C.size()) {
+            rows = std::max(C.size(), 2*rows);
+            for (Vec& column : columns) { column.grow(rows); }
+            work = la::ReductionColumn<number,timeunit>(rows);
+        }
+
+        for (int simplexN = size(); simplexN < C.size(); simplexN++) {
+            const top::Simplex<indextype>& simplex = C[simplexN];
+
+            // the same signs as top::boundary
+            Vec column(rows);
+            number coeff = -1;
+            for (int j = 0; j <= simplex.dim() && simplex.dim() > 0; j++) {
+                column.pushBack(C.getIndex(simplex.erase(j)), coeff);
+                coeff = coeff * number(-1);
+            }
+            column.sort();
+            push(std::move(column), C.getTime(simplexN));
+        }
+    }
+
+    template <typename number,typename timeunit>
+    void OnlineModule<number,timeunit>::push(Vec&& column, const timeunit& time) {
+        work.reduce(column, pivot_cols, columns);
+        if (!column.isZero()) { pivot_cols[column.pivotDim()] = columns.size(); }
+
+        columns.push_back(std::move(column));
+        times.push_back(time);
+    }
+
+    template <typename number,typename timeunit>
+    void OnlineModule<number,timeunit>::getBarcode(std::vector<std::pair<timeunit,timeunit>>& barcode) const {
+        barcode.clear();
+        for (int colN = 0; colN < size(); colN++) {
+            if (!columns[colN].isZero()) { continue; }
+
+            const int killer = pivot_cols[colN];
+            barcode.push_back({ times[colN], killer == -1 ? timeunit(timeunit::INF) : times[killer] });
+        }
+    }
+}
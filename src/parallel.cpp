@@ -0,0 +1,176 @@
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <exception>
+#include <algorithm>
+#include <condition_variable>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include "parallel.h"
+
+namespace parallel {
+
+    namespace {
+        int defaultThreadCount() {
+            const char* env = std::getenv("TOP_THREADS");
+            if (env != nullptr && std::atoi(env) > 0) { return std::atoi(env); }
+            return std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        std::atomic<int> thread_count(defaultThreadCount());
+
+        // set on the threads which are running a task
+        thread_local bool in_task = false;
+
+        // a loop which is being processed by the pool
+        struct Job {
+            const std::function<void(int)>* task;
+            int n;
+            std::atomic<int> next;
+
+            std::mutex error_mutex;
+            std::exception_ptr error;
+
+            Job(const std::function<void(int)>& task, const int& n): task(&task), n(n), next(0) {}
+
+            // takes the indices until there are none left
+            void process() {
+                const bool nested = in_task;
+                in_task = true;
+                for (int i = next++; i < n; i = next++) {
+                    try {
+                        (*task)(i);
+                    }
+                    catch (...) {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!error) { error = std::current_exception(); }
+                    }
+                }
+                in_task = nested;
+            }
+        };
+
+#ifndef CGAL_LINKED_WITH_TBB
+        // the workers sleep until a job is posted, the posting thread works on it as well
+        class ThreadPool {
+        public:
+            ~ThreadPool() { resize(0); }
+
+            // the number of threads working on a job (the workers and the posting thread)
+            int size() const { return workers.size() + 1; }
+
+            void resize(const int& threads) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stopping = true;
+                }
+                wake.notify_all();
+                for (std::thread& worker : workers) { worker.join(); }
+                workers.clear();
+
+                stopping = false;
+                for (int i = 1; i < threads; i++) {
+                    workers.emplace_back([this]() { work(); });
+                }
+            }
+
+            void run(Job& job) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    current = &job;
+                    ++generation;
+                }
+                wake.notify_all();
+                job.process();
+
+                // the workers which picked up the job have to be done with it
+                std::unique_lock<std::mutex> lock(mutex);
+                finished.wait(lock, [&]() { return active == 0; });
+                current = nullptr;
+            }
+
+        private:
+            void work() {
+                unsigned long seen = 0;
+                std::unique_lock<std::mutex> lock(mutex);
+                while (true) {
+                    wake.wait(lock, [&]() { return stopping || generation != seen; });
+                    if (stopping) { return; }
+                    seen = generation;
+                    if (current == nullptr) { continue; }
+
+                    Job& job = *current;
+                    ++active;
+                    lock.unlock();
+                    job.process();
+                    lock.lock();
+                    if (--active == 0) { finished.notify_all(); }
+                }
+            }
+
+            std::vector<std::thread> workers;
+            std::mutex mutex;
+            std::condition_variable wake;
+            std::condition_variable finished;
+
+            Job* current = nullptr;
+            unsigned long generation = 0;
+            int active = 0;
+            bool stopping = false;
+        };
+
+        // one loop at a time goes to the pool
+        std::mutex submit_mutex;
+
+        ThreadPool& pool() {
+            static ThreadPool p;
+            if (p.size() != thread_count) { p.resize(thread_count); }
+            return p;
+        }
+#endif
+    }
+
+    int threadCount() {
+        return thread_count;
+    }
+
+    void setThreadCount(const int& threads) {
+        thread_count = std::max(1, threads);
+    }
+
+    int chunkCount(const int& count, const int& min_chunk) {
+        const int max_chunks = (count + min_chunk - 1) / std::max(1, min_chunk);
+        return std::max(1, std::min(max_chunks, 4*threadCount()));
+    }
+
+    void forEach(const int& n, const std::function<void(int)>& task) {
+        if (n <= 0) { return; }
+        if (n == 1 || in_task || threadCount() == 1) {
+            for (int i = 0; i < n; i++) { task(i); }
+            return;
+        }
+
+        Job job(task, n);
+#ifdef CGAL_LINKED_WITH_TBB
+        tbb::task_arena arena(threadCount());
+        arena.execute([&]() {
+            tbb::parallel_for(0, threadCount(), [&](const int&) { job.process(); });
+        });
+#else
+        std::unique_lock<std::mutex> submit(submit_mutex, std::try_to_lock);
+        if (!submit.owns_lock()) {
+            job.process();
+        }
+        else {
+            pool().run(job);
+        }
+#endif
+        if (job.error) { std::rethrow_exception(job.error); }
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef _PARALLEL_H
+#define _PARALLEL_H
+
+#include <functional>
+
+/// Data parallel loops for the construction of the complexes. With TBB (the
+/// same condition under which CGAL uses it) the loops go to tbb::parallel_for,
+/// otherwise to a small pool of worker threads owned by the library.
+namespace parallel {
+
+    /// the number of threads used by forEach, by default $TOP_THREADS or the
+    /// hardware concurrency
+    int threadCount();
+    /// sets the number of threads (including the calling one), 1 runs all the
+    /// loops serially
+    void setThreadCount(const int& threads);
+
+    /// calls task(i) for all i in [0,n) and waits for them, the calls have to be
+    /// independent. A loop started inside a task (or while the pool is busy with
+    /// another loop) runs serially on the calling thread. The first exception
+    /// thrown by a task is rethrown once all the tasks are done.
+    void forEach(const int& n, const std::function<void(int)>& task);
+
+    /// the number of tasks forEach should be given to process count items in
+    /// chunks of at least min_chunk items (a few tasks per thread to balance the load)
+    int chunkCount(const int& count, const int& min_chunk);
+}
+
+#endif
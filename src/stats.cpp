@@ -0,0 +1,120 @@
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+
+#include "stats.h"
+
+namespace stats {
+
+    namespace {
+        std::mutex output_mutex;
+
+        std::string& jsonPath() {
+            static std::string path = std::getenv("TOP_STATS_JSON") != nullptr ? std::getenv("TOP_STATS_JSON") : "";
+            return path;
+        }
+
+        thread_local std::array<int,PHASE_COUNT> depth {};
+    }
+
+    const char* phaseName(const Phase& phase) {
+        switch (phase) {
+            case Phase::Insertion: return "insertion";
+            case Phase::Faces: return "faces";
+            case Phase::Miniball: return "miniball";
+            case Phase::Finalize: return "finalize";
+            case Phase::Boundary: return "boundary";
+            case Phase::Decompose: return "decompose";
+            case Phase::Solve: return "solve";
+            default: return "unknown";
+        }
+    }
+
+    Stats snapshot() {
+        const detail::Counters& c = detail::counters();
+
+        Stats result;
+        for (int phaseN = 0; phaseN < PHASE_COUNT; phaseN++) {
+            result.seconds[phaseN] = c.nanos[phaseN].load(std::memory_order_relaxed) * 1e-9;
+            result.calls[phaseN] = c.calls[phaseN].load(std::memory_order_relaxed);
+        }
+        result.column_additions = c.column_additions.load(std::memory_order_relaxed);
+        result.fill_in = c.fill_in.load(std::memory_order_relaxed);
+        result.peak_column_length = c.peak_column_length.load(std::memory_order_relaxed);
+        result.allocations = c.allocations.load(std::memory_order_relaxed);
+        result.hash_lookups = c.hash_lookups.load(std::memory_order_relaxed);
+        result.apparent_pairs = c.apparent_pairs.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    void reset() {
+        detail::Counters& c = detail::counters();
+
+        for (int phaseN = 0; phaseN < PHASE_COUNT; phaseN++) {
+            c.nanos[phaseN].store(0, std::memory_order_relaxed);
+            c.calls[phaseN].store(0, std::memory_order_relaxed);
+        }
+        c.column_additions.store(0, std::memory_order_relaxed);
+        c.fill_in.store(0, std::memory_order_relaxed);
+        c.peak_column_length.store(0, std::memory_order_relaxed);
+        c.allocations.store(0, std::memory_order_relaxed);
+        c.hash_lookups.store(0, std::memory_order_relaxed);
+        c.apparent_pairs.store(0, std::memory_order_relaxed);
+    }
+
+    void writeJson(std::ostream& os, const Stats& s) {
+        os << "{\"phases\":{";
+        for (int phaseN = 0; phaseN < PHASE_COUNT; phaseN++) {
+            os << (phaseN > 0 ? "," : "")
+               << "\"" << phaseName(static_cast<Phase>(phaseN)) << "\":"
+               << "{\"seconds\":" << s.seconds[phaseN] << ",\"calls\":" << s.calls[phaseN] << "}";
+        }
+        os << "},\"column_additions\":" << s.column_additions
+           << ",\"fill_in\":" << s.fill_in
+           << ",\"peak_column_length\":" << s.peak_column_length
+           << ",\"allocations\":" << s.allocations
+           << ",\"hash_lookups\":" << s.hash_lookups
+           << ",\"apparent_pairs\":" << s.apparent_pairs
+           << "}";
+    }
+
+    void setJsonOutput(const std::string& path) {
+        std::lock_guard<std::mutex> lock(output_mutex);
+        jsonPath() = path;
+    }
+
+    void dumpJson() {
+        const Stats s = snapshot();
+
+        std::lock_guard<std::mutex> lock(output_mutex);
+        if (jsonPath().empty()) { return; }
+
+        std::ofstream out(jsonPath(), std::ios::app);
+        writeJson(out, s);
+        out << "\n";
+    }
+
+    namespace detail {
+        Counters& counters() {
+            // zero-initialized, the storage is static
+            static Counters c;
+            return c;
+        }
+
+        ScopedTimer::ScopedTimer(const Phase& phase):
+            phaseN(static_cast<int>(phase)),
+            outermost(depth[phaseN]++ == 0),
+            start(std::chrono::steady_clock::now()) {}
+
+        ScopedTimer::~ScopedTimer() {
+            --depth[phaseN];
+            if (!outermost) { return; }
+
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            counters().nanos[phaseN].fetch_add(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                    std::memory_order_relaxed);
+            counters().calls[phaseN].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
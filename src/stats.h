@@ -0,0 +1,132 @@
+#ifndef _STATS_H
+#define _STATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <iostream>
+
+/// Instrumentation of the barcode pipeline: per-phase wall time and the
+/// counters of the hot paths. The recording is compiled in only when TOP_STATS
+/// is defined, otherwise the macros below expand to nothing and the stats
+/// stay at zero.
+namespace stats {
+
+    /// the phases of the pipeline (from the points to the barcode)
+    enum class Phase {
+        Insertion,      ///< Delaunay insertion
+        Faces,          ///< enumerating the simplices of the Delaunay triangulation
+        Miniball,       ///< smallest enclosing balls
+        Finalize,       ///< Complex::finalize
+        Boundary,       ///< top::boundary
+        Decompose,      ///< kernel and image of the boundary
+        Solve,          ///< expressing the relations in the generators
+        Count
+    };
+
+    constexpr int PHASE_COUNT = static_cast<int>(Phase::Count);
+
+    const char* phaseName(const Phase&);
+
+    /// a snapshot of the recorded values (summed over all threads)
+    struct Stats {
+        std::array<double,PHASE_COUNT> seconds {};  ///< wall time of the outermost calls
+        std::array<long,PHASE_COUNT> calls {};      ///< number of the outermost calls
+
+        long column_additions = 0;      ///< col += k*col operations
+        long fill_in = 0;               ///< nonzeros created by the column additions (net growth)
+        long peak_column_length = 0;    ///< longest column produced by an addition
+        long allocations = 0;           ///< column buffers (re)allocated by the additions
+        long hash_lookups = 0;          ///< simplex and point lookups
+        long apparent_pairs = 0;        ///< positive columns skipped by the apparent pairs
+
+        double phaseSeconds(const Phase& phase) const { return seconds[static_cast<int>(phase)]; }
+        long phaseCalls(const Phase& phase) const { return calls[static_cast<int>(phase)]; }
+    };
+
+    /// true if the library was compiled with TOP_STATS
+    constexpr bool enabled() {
+#ifdef TOP_STATS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /// returns the values recorded since the last reset
+    Stats snapshot();
+    /// zeroes all the values
+    void reset();
+
+    /// writes the stats as a single line JSON object
+    void writeJson(std::ostream&, const Stats&);
+    /// every constructed Module appends a line with the current stats to this
+    /// file, an empty path turns it off (the default is $TOP_STATS_JSON)
+    void setJsonOutput(const std::string& path);
+    /// appends the current stats to the JSON output (if any), called at the end
+    /// of the Module construction
+    void dumpJson();
+
+    namespace detail {
+        struct Counters {
+            std::array<std::atomic<long long>,PHASE_COUNT> nanos;
+            std::array<std::atomic<long>,PHASE_COUNT> calls;
+
+            std::atomic<long> column_additions;
+            std::atomic<long> fill_in;
+            std::atomic<long> peak_column_length;
+            std::atomic<long> allocations;
+            std::atomic<long> hash_lookups;
+            std::atomic<long> apparent_pairs;
+        };
+
+        Counters& counters();
+
+        inline void add(std::atomic<long>& counter, const long& n) {
+            counter.fetch_add(n, std::memory_order_relaxed);
+        }
+
+        inline void max(std::atomic<long>& counter, const long& n) {
+            long curr = counter.load(std::memory_order_relaxed);
+            while (curr < n && !counter.compare_exchange_weak(curr, n, std::memory_order_relaxed)) {}
+        }
+
+        /// times the outermost scope of the phase on this thread, so recursive
+        /// and nested calls (i.e. solve on a masked matrix) are not counted twice
+        class ScopedTimer {
+        public:
+            explicit ScopedTimer(const Phase& phase);
+            ~ScopedTimer();
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator =(const ScopedTimer&) = delete;
+        private:
+            const int phaseN;
+            const bool outermost;
+            const std::chrono::steady_clock::time_point start;
+        };
+    }
+}
+
+#ifdef TOP_STATS
+#define STATS_CONCAT_(a, b) a##b
+#define STATS_CONCAT(a, b) STATS_CONCAT_(a, b)
+/// times the rest of the enclosing scope as the given phase
+#define STATS_PHASE(PHASE) \
+    const stats::detail::ScopedTimer STATS_CONCAT(stats_timer_, __LINE__)(stats::Phase::PHASE)
+/// adds N to the counter
+#define STATS_ADD(COUNTER, N) \
+    stats::detail::add(stats::detail::counters().COUNTER, (N))
+/// raises the counter to N
+#define STATS_MAX(COUNTER, N) \
+    stats::detail::max(stats::detail::counters().COUNTER, (N))
+#define STATS_DUMP() stats::dumpJson()
+#else
+#define STATS_PHASE(PHASE)
+#define STATS_ADD(COUNTER, N)
+#define STATS_MAX(COUNTER, N)
+#define STATS_DUMP()
+#endif
+
+#endif
@@ -0,0 +1,141 @@
+#include <cmath>
+#include <algorithm>
+
+#include "summary.h"
+
+namespace summary {
+
+    namespace {
+        double step(const Grid& grid) {
+            return grid.size > 1 ? (grid.max - grid.min) / (grid.size - 1) : 0;
+        }
+
+        // the death with the essential classes cut off at the end of the grid
+        double death(const std::pair<double,double>& point, const Grid& grid) {
+            return std::isinf(point.second) ? std::max(grid.max, point.first) : point.second;
+        }
+
+        // the samples [first,last) inside the support (birth,death) of a tent
+        void support(const Grid& grid, const double& birth, const double& death, int& first, int& last) {
+            const double h = step(grid);
+            if (h <= 0) {
+                first = 0;
+                last = grid.size > 0 && birth < grid.min && grid.min < death ? 1 : 0;
+                return;
+            }
+            // clamped before the conversion, the times can be far off the grid
+            first = std::min(std::max(std::floor((birth - grid.min) / h) + 1, 0.0), double(grid.size));
+            last = std::min(std::max(std::ceil((death - grid.min) / h), double(first)), double(grid.size));
+        }
+
+        // the weights of the gaussian on the pixels of the grid
+        void pixels(const Grid& grid, const double& center, const double& sigma, double* out) {
+            const double h = (grid.max - grid.min) / grid.size;
+            const double scale = 1 / (sigma * std::sqrt(2.0));
+            double lower = std::erf((grid.min - center) * scale);
+            for (int i = 0; i < grid.size; i++) {
+                const double upper = std::erf((grid.min + (i+1)*h - center) * scale);
+                out[i] = (upper - lower) / 2;
+                lower = upper;
+            }
+        }
+    }
+
+    void landscape(const diagram::Diagram& diagram, const Grid& grid, const int& levels, double* out) {
+        ASSERT(levels >= 0 && grid.size >= 0);
+        const int size = grid.size;
+        const double h = step(grid);
+
+        // the largest values of every sample (in decreasing order) are kept together
+        std::vector<double> top(size_t(size) * levels, 0);
+        for (const std::pair<double,double>& point : diagram) {
+            const double birth = point.first, end = death(point, grid);
+            int first, last;    support(grid, birth, end, first, last);
+            for (int i = first; i < last; i++) {
+                const double t = grid.min + i*h;
+                double value = std::min(t - birth, end - t);
+                double* values = top.data() + size_t(i) * levels;
+                for (int level = 0; level < levels && value > 0; level++) {
+                    if (value > values[level]) { std::swap(value, values[level]); }
+                }
+            }
+        }
+
+        for (int level = 0; level < levels; level++) {
+            for (int i = 0; i < size; i++) { out[size_t(level)*size + i] = top[size_t(i)*levels + level]; }
+        }
+    }
+
+    void silhouette(const diagram::Diagram& diagram, const Grid& grid, const double& power, double* out) {
+        ASSERT(grid.size >= 0);
+        const int size = grid.size;
+        const double h = step(grid);
+        std::fill(out, out + size, 0.0);
+
+        double total = 0;
+        for (const std::pair<double,double>& point : diagram) {
+            const double birth = point.first, end = death(point, grid);
+            if (!(birth < end)) { continue; }
+            const double weight = std::pow(end - birth, power);
+            total += weight;
+
+            // no branches, so the loop is vectorized
+            int first, last;    support(grid, birth, end, first, last);
+            for (int i = first; i < last; i++) {
+                const double t = grid.min + i*h;
+                out[i] += weight * std::max(0.0, std::min(t - birth, end - t));
+            }
+        }
+
+        if (total > 0) {
+            const double inv = 1 / total;
+            for (int i = 0; i < size; i++) { out[i] *= inv; }
+        }
+    }
+
+    void image(const diagram::Diagram& diagram, const Grid& births, const Grid& persistences,
+            const double& sigma, const double& power, double* out) {
+        ASSERT(sigma > 0 && births.size >= 0 && persistences.size >= 0);
+        const int width = births.size, height = persistences.size;
+        std::fill(out, out + size_t(width) * height, 0.0);
+
+        // the gaussian is separable, so every point adds the outer product of its
+        // weights on the birth pixels and on the persistence pixels
+        std::vector<double> xs(width), ys(height);
+        for (const std::pair<double,double>& point : diagram) {
+            const double persistence = std::isinf(point.second) ? persistences.max : point.second - point.first;
+            if (!(persistence > 0)) { continue; }
+
+            pixels(births, point.first, sigma, xs.data());
+            pixels(persistences, persistence, sigma, ys.data());
+            const double weight = std::pow(persistence, power);
+            for (int y = 0; y < height; y++) {
+                const double wy = weight * ys[y];
+                double* row = out + size_t(y) * width;
+                for (int x = 0; x < width; x++) { row[x] += wy * xs[x]; }
+            }
+        }
+    }
+
+    void landscapes(const std::vector<diagram::Diagram>& diagrams, const Grid& grid, const int& levels, double* out) {
+        const size_t stride = size_t(levels) * grid.size;
+        parallel::forEach(diagrams.size(), [&](const int& diagramN) {
+            landscape(diagrams[diagramN], grid, levels, out + diagramN * stride);
+        });
+    }
+
+    void silhouettes(const std::vector<diagram::Diagram>& diagrams, const Grid& grid, const double& power, double* out) {
+        const size_t stride = grid.size;
+        parallel::forEach(diagrams.size(), [&](const int& diagramN) {
+            silhouette(diagrams[diagramN], grid, power, out + diagramN * stride);
+        });
+    }
+
+    void images(const std::vector<diagram::Diagram>& diagrams, const Grid& births, const Grid& persistences,
+            const double& sigma, const double& power, double* out) {
+        const size_t stride = size_t(births.size) * persistences.size;
+        parallel::forEach(diagrams.size(), [&](const int& diagramN) {
+            image(diagrams[diagramN], births, persistences, sigma, power, out + diagramN * stride);
+        });
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef _SUMMARY_H
+#define _SUMMARY_H
+
+#include <vector>
+
+#include "diagram.h"
+
+/// Fixed length vectors of persistence diagrams (landscapes, silhouettes and
+/// persistence images) for the statistics and the learning on barcodes. The
+/// diagrams of a single dimension go in (see diagram::fromBarcode), the values
+/// are written to buffers given by the caller, the batch versions write the
+/// vectors of all the diagrams one after another into a single buffer.
+/// The essential classes (the infinite deaths) are cut off at the end of the grid
+/// (at the largest persistence for the images), the finite points are not.
+namespace summary {
+
+    /// size samples from min to max (both included), for the images the range is
+    /// split into size pixels instead
+    struct Grid {
+        double min;
+        double max;
+        int size;
+    };
+
+    /// the first levels persistence landscapes on the grid, out[level*grid.size + i]
+    /// is the value of the (level+1)-th largest tent function at the i-th sample
+    void landscape(const diagram::Diagram&, const Grid&, const int& levels, double* out);
+    /// the silhouette on the grid, the mean of the tent functions weighted by their
+    /// persistence to the given power (zero for an empty diagram)
+    void silhouette(const diagram::Diagram&, const Grid&, const double& power, double* out);
+    /// the persistence image on the birth and persistence grids, the points are
+    /// gaussians of the given deviation weighted by their persistence to the power,
+    /// integrated over the pixels. out[p*births.size + b] is the pixel of the b-th
+    /// birth and the p-th persistence.
+    void image(const diagram::Diagram&, const Grid& births, const Grid& persistences,
+            const double& sigma, const double& power, double* out);
+
+    /// the summaries of all the diagrams (computed in parallel), the ones of the
+    /// i-th diagram start at out + i*levels*grid.size, out + i*grid.size and
+    /// out + i*births.size*persistences.size
+    void landscapes(const std::vector<diagram::Diagram>&, const Grid&, const int& levels, double* out);
+    void silhouettes(const std::vector<diagram::Diagram>&, const Grid&, const double& power, double* out);
+    void images(const std::vector<diagram::Diagram>&, const Grid& births, const Grid& persistences,
+            const double& sigma, const double& power, double* out);
+}
+
+#endif
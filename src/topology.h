@@ -11,6 +11,7 @@
 
 
 #include "toprep.h"
+#include "stats.h"
 namespace top{
 
     // simplex class - mainly for templating
@@ -117,8 +118,15 @@ namespace top{
     //TODO add copy/move, a complex with empty
 
     void insert(const simplex&, const timeunit&);
+    /// appends the simplices of a complex built separately (i.e. a fragment
+    /// built on another thread), neither of them may be finalized yet
+    void merge(Complex&&);
 
     void finalize();
+    /// appends a simplex to a finalized complex (online), it has to come last in the
+    /// filtration order and all its facets have to be in the complex already,
+    /// returns its index
+    int append(const simplex&, const timeunit&);
     bool verify() const;
 
     bool is_finalized() const; 
@@ -140,6 +148,11 @@ namespace top{
 
    template<typename number, typename timeunit, typename indextype>
    toprep::Map<number,timeunit> boundary(Complex<timeunit,indextype>& C);
+   /// boundary of the subcomplex of the simplices up to max_time (a prefix of the
+   /// filtration), the simplices after it are never looked at. So the barcode of
+   /// it reports every class which dies after max_time as an infinite bar.
+   template<typename number, typename timeunit, typename indextype>
+   toprep::Map<number,timeunit> boundary(Complex<timeunit,indextype>& C, const timeunit& max_time);
        
 
     // I/O
@@ -147,6 +160,16 @@ namespace top{
     std::ostream& operator <<(std::ostream&, const Simplex<indextype>&);
 
 
+    /// finds the indices of the simplices of the subcomplex C_B in C_A
+    template<typename timeunit, typename indextype>
+    void subcomplexIndices(const Complex<timeunit,indextype>& C_A, const Complex<timeunit,indextype>& C_B,
+            std::vector<int>& indices);
+
+    /// boundary of C_A relative to the subcomplex C_B, the rows and columns
+    /// of the simplices of C_B are zeroed out (use together with subcomplexIndices
+    /// and toprep::relativeHomology). The zeroing is lazy, so when sweeping over
+    /// many subcomplexes it is cheaper to zero out a single boundary of C_A and
+    /// call clearMasks after each subcomplex.
     template<typename number, typename timeunit, typename indextype>
     toprep::Map<number,timeunit> relativeBoundary(Complex<timeunit,indextype>& C_A,Complex<timeunit,indextype>& C_B);
 
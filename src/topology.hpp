@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <iterator>
 
 
 namespace top{
@@ -193,8 +194,24 @@ namespace top{
 	num_simplices++;
    }
 
+   template<typename timeunit,typename indextype>
+   void Complex<timeunit,indextype>::merge(Complex&& fragment){
+	ASSERT(!finalized && !fragment.finalized);
+	if(data.empty()){
+		data = std::move(fragment.data);
+	}
+	else{
+		data.insert(data.end(),std::make_move_iterator(fragment.data.begin()),std::make_move_iterator(fragment.data.end()));
+	}
+	num_simplices += fragment.num_simplices;
+
+	fragment.data.clear();
+	fragment.num_simplices = 0;
+   }
+
    template<typename timeunit,typename indextype>
    void Complex<timeunit,indextype>::finalize(){
+	STATS_PHASE(Finalize);
    	struct filt_order
 	{
 	    inline bool operator() (const entry& a, const entry& b)
@@ -223,6 +240,34 @@ namespace top{
    	finalized=true;
    }
    
+   template<typename timeunit,typename indextype>
+   int Complex<timeunit,indextype>::append(const Simplex<indextype>& simp,const timeunit& t){
+	ASSERT(finalized);
+	ASSERT(num_simplices==0 || !(t<data[num_simplices-1].second));
+	ASSERT(!is_defined(simp));
+	for(int j=0;j<=simp.dim() && simp.dim()>0;++j){
+		ASSERT(is_defined(simp.erase(j)));
+	}
+
+	// the tail left by finalize is reused, otherwise the data might move and
+	// the references held by the reverse map have to be renewed
+	if(num_simplices<int(data.size())){
+		data[num_simplices] = entry(simp,t);
+	}
+	else{
+		const entry* const old_data = data.data();
+		data.push_back(entry(simp,t));
+		if(data.data()!=old_data){
+			reverse_map.clear();
+			for(int i=0;i<num_simplices;++i){
+				reverse_map.insert(std::make_pair(std::cref(data[i].first),i));
+			}
+		}
+	}
+	reverse_map.insert(std::make_pair(std::cref(data[num_simplices].first),num_simplices));
+	return num_simplices++;
+   }
+
    template<typename timeunit, typename indextype>
    bool Complex<timeunit,indextype>::is_finalized() const{
    	return finalized;
@@ -231,6 +276,7 @@ namespace top{
  
    template<typename timeunit, typename indextype>
    bool Complex<timeunit,indextype>::is_defined(const Simplex<indextype>& simp) const{
+	STATS_ADD(hash_lookups, 1);
    	return !(reverse_map.find(simp)==reverse_map.end());
    }
    
@@ -260,11 +306,13 @@ namespace top{
 
    template<typename timeunit,typename indextype> 
    timeunit Complex<timeunit,indextype>::getTime(const Simplex<indextype>& simp) const {
+	STATS_ADD(hash_lookups, 1);
    	return data[reverse_map.at(simp)].second;
    }
 
    template<typename timeunit,typename indextype> 
    int Complex<timeunit,indextype>::getIndex(const Simplex<indextype>& simp) const {
+	STATS_ADD(hash_lookups, 1);
    	return reverse_map.at(simp);
    }
 
@@ -277,9 +325,26 @@ namespace top{
 
  template<typename number, typename timeunit, typename indextype>
    toprep::Map<number,timeunit> boundary(Complex<timeunit,indextype>& C){
+	return boundary<number>(C,timeunit(timeunit::INF));
+   }
+
+ template<typename number, typename timeunit, typename indextype>
+   toprep::Map<number,timeunit> boundary(Complex<timeunit,indextype>& C,const timeunit& max_time){
+    STATS_PHASE(Boundary);
     ASSERT(C.is_finalized());
     ASSERT(C.verify());
-	int complex_size = C.size();
+	// the times are sorted, so the simplices up to max_time are a prefix
+	int complex_size = 0;
+	int upper = C.size();
+	while(complex_size<upper){
+		const int mid = (complex_size+upper)/2;
+		if(max_time<C.getTime(mid)){
+			upper = mid;
+		}
+		else{
+			complex_size = mid+1;
+		}
+	}
 	toprep::Map<number,timeunit> D(complex_size,complex_size);
 	for(auto i = 0; i< complex_size;++i){
 		la::Vector<number,timeunit> chain(complex_size);
@@ -305,57 +370,32 @@ namespace top{
 	return D;
    }
 
+ template<typename timeunit, typename indextype>
+   void subcomplexIndices(const Complex<timeunit,indextype>& C_A, const Complex<timeunit,indextype>& C_B,
+		   std::vector<int>& indices){
+	indices.clear();
+	indices.reserve(C_B.size());
+	for(int i = 0; i < C_B.size(); ++i){
+		ASSERT(C_A.is_defined(C_B[i]));
+		indices.push_back(C_A.getIndex(C_B[i]));
+	}
+	std::sort(indices.begin(),indices.end());
+   }
+
  template<typename number, typename timeunit, typename indextype>
     toprep::Map<number,timeunit> relativeBoundary(Complex<timeunit,indextype>& C_A,Complex<timeunit,indextype>& C_B){
-	ASSERT(C_A.is_finalized());
-    ASSERT(C_A.verify());
 	ASSERT(C_B.is_finalized());
-    ASSERT(C_B.verify());
-
-	int complex_size = C_A.size() + C_B.size();
 
-	toprep::Map<number,timeunit> D(complex_size,complex_size);
-	int ind_A=0;
-	int ind_B=0;
+	// the subcomplex lives in the filtration of C_A, so we
+	// only have to zero out its rows and columns in place
+	std::vector<int> subcomplex;
+	subcomplexIndices(C_A, C_B, subcomplex);
 
-	for(auto i = 0; i< complex_size;++i){
-		la::Vector<number,timeunit> chain(complex_size);
-		number coeff = -1;
-		const number neg = -1;
-		timeunit t; 
-		
-		if(C_A.getTime(ind_A)<=C_B.getTime(ind_B)){
-			if(C_A[ind_A].dim()>0){
-				for(auto j=0; j<=C_A[ind_A].dim(); ++j){
-		    			const Simplex<indextype> s =  C_A[i].erase(j);
-					int indx = C_A.getIndex(s); 
-		        		chain.pushBack(indx,coeff);
-		                	coeff=coeff*neg;	   
-				}
-			}
-			t = C_A.getTime(ind_A++);
-		}
-		else{
-			int indx = C_B.getIndex(C_B[ind_B]); 
-		        chain.pushBack(indx,coeff*neg);
-			t = C_B.getTime(ind_B++);
-		}
-		
-		
-		chain.sort();
-		D.lazyInsert(chain,t,i);
-	
-    	}
-	D.copyTimes();
+	toprep::Map<number,timeunit> D = boundary<number,timeunit,indextype>(C_A);
+	D.zeroRows(subcomplex);
+	D.zeroColumns(subcomplex);
 
 	return D;
-
-
-	    
   }
-		    
-
-
-
 
 }
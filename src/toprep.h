@@ -3,6 +3,7 @@
 
 #include "linalg.h"
 #include "tstep.h"
+#include "stats.h"
 
 namespace toprep {
 
@@ -48,7 +49,17 @@ namespace toprep {
         using Mat::lazyInsert;
         using Mat::lazyAppend;
         using Mat::copyTimes;
-        using Mat::isReducedForm;	
+        using Mat::isReducedForm;
+        using Mat::rows;
+        using Mat::cols;
+        using Mat::getColTime;
+        using Mat::getRowTime;
+        using Mat::zeroRows;
+        using Mat::zeroColumns;
+        using Mat::clearMasks;
+        using Mat::applyMasks;
+        using Mat::hasMasks;
+        using Mat::apparentPairs;
         /// applies itself to the space
         Space<number,timeunit> operator ()(const Space<number,timeunit>& space) const;
         /// maps the vector
@@ -56,6 +67,12 @@ namespace toprep {
 
         /// finds this maps kernal and image
         void decompose(Space<number,timeunit>& kernel, Space<number,timeunit>& image) const;
+        /// finds the kernel and image, skipping the relative-trivial columns
+        void decompose(Space<number,timeunit>& kernel, Space<number,timeunit>& image,
+                const std::vector<int>& trivial_cols) const;
+        /// finds the kernel and image of a boundary map, the apparent pairs are not reduced
+        void decompose(Space<number,timeunit>& kernel, Space<number,timeunit>& image,
+                const std::vector<int>& trivial_cols, const std::vector<std::pair<int,int>>& apparent_pairs) const;
         /// find the kernel
         void kernel(Space<number,timeunit>& kernel) const;
         /// maps the basis vectors of the input space
@@ -66,10 +83,25 @@ namespace toprep {
         /// returns the barcode
         /// TODO: Luka to Primoz: please think of a good name for this function and write a comment :)
         void getDomainImgTimeDiffs(std::vector<std::pair<timeunit,timeunit>>&) const;
+        /// only the bars of positive length at least min_persistence (and the infinite
+        /// ones), the other rows are skipped without storing an interval. The map is
+        /// already reduced, so this only saves the output, not the reduction.
+        void getDomainImgTimeDiffs(std::vector<std::pair<timeunit,timeunit>>&, const timeunit& min_persistence) const;
 
+        /// merges the columns of both maps by time, the result is in reduced form
+        /// (only the columns colliding with an existing pivot get reduced)
         Map<number,timeunit> operator +(const Map<number,timeunit>&) const;
         Map<number,timeunit> operator -(const Map<number,timeunit>&) const;
 
+        /// the same map with other row and column times (i.e. their ranks, see
+        /// toprep::rank), the map must not have any lazily zeroed rows or columns
+        template <typename tmunit>
+        Map<number,tmunit> retime(const std::vector<tmunit>& row_times, const std::vector<tmunit>& col_times) const;
+        /// the square map with its rows and columns in another order (order[i] is the
+        /// index of the new i-th row and column) and the given times of the new order
+        template <typename tmunit>
+        Map<number,tmunit> permute(const std::vector<int>& order, const std::vector<tmunit>& times) const;
+
         /// finds a map from the domain space to the image space
         static void find(const Space<number,timeunit>& domain, Map<number,timeunit>&, const Space<number,timeunit>& image);
 
@@ -96,17 +128,43 @@ namespace toprep {
 
         /// extracts the persistence module from the boundry operator
         Module(const Map<number,timeunit>& boundry);
+        /// extracts the relative persistence module H(K,L) from the boundry operator
+        /// of K with the rows and columns of L zeroed out, the subcomplex L is given
+        /// by the indices of its simplices in K
+        Module(const Map<number,timeunit>& boundry, const std::vector<int>& subcomplex);
 
         /// extracts the barcode from this boundry map
         void getBarcode(std::vector<std::pair<timeunit,timeunit>>&) const;
+        /// only the bars of positive length at least min_persistence (and the infinite
+        /// ones). The module is fully reduced either way (the short pairs are needed to
+        /// reduce the others), only the boundary up to a time (see top::boundary) also
+        /// limits the computation, its bars dying after that time are infinite.
+        void getBarcode(std::vector<std::pair<timeunit,timeunit>>&, const timeunit& min_persistence) const;
     };
 
     using BinaryModule = Module<binary>;
     using TernaryModule = Module<ternary>;
 
+    /// computes the barcode of the relative homology H(K,L), see top::relativeBoundary
+    template <typename number, typename timeunit>
+    void relativeHomology(const Map<number,timeunit>& boundry, const std::vector<int>& subcomplex,
+            std::vector<std::pair<timeunit,timeunit>>& barcode);
+
+    /// replaces the row and column times of the map by their ranks among its
+    /// distinct times, values[rank] is the time of the rank. The order of the times
+    /// is the same, so the reduction of the ranked map finds the same pairs while
+    /// only comparing (and storing) 32 bit integers.
+    template <typename number, typename timeunit>
+    Map<number,tstep> rank(const Map<number,timeunit>& map, std::vector<timeunit>& values);
+
+    /// translates a barcode of ranks back to the times, the infinite bars stay infinite
+    template <typename timeunit>
+    void unrank(const std::vector<std::pair<tstep,tstep>>& ranks, const std::vector<timeunit>& values,
+            std::vector<std::pair<timeunit,timeunit>>& barcode);
+
+    /// computes the barcode of the boundry on the ranks of its times
     template <typename number, typename timeunit>
-    void relativeHomology(const Module<number,timeunit>&, const Map<number,timeunit>&,
-            const Module<number,timeunit>&, const Map<number,timeunit>&, const Module<number,timeunit>&);
+    void rankedBarcode(const Map<number,timeunit>& boundry, std::vector<std::pair<timeunit,timeunit>>& barcode);
 }
 
 #include "toprep.hpp"
@@ -44,9 +44,22 @@ namespace toprep {
         Matrix<number,timeunit>::decompose(kernel, image);
     }
 
+    template <typename number,typename timeunit>
+    void Map<number,timeunit>::decompose(Space<number,timeunit>& kernel, Space<number,timeunit>& image,
+            const std::vector<int>& trivial_cols) const {
+        Matrix<number,timeunit>::decompose(kernel, image, trivial_cols);
+    }
+
+    template <typename number,typename timeunit>
+    void Map<number,timeunit>::decompose(Space<number,timeunit>& kernel, Space<number,timeunit>& image,
+            const std::vector<int>& trivial_cols, const std::vector<std::pair<int,int>>& apparent_pairs) const {
+        Matrix<number,timeunit>::decompose(kernel, image, trivial_cols, apparent_pairs);
+    }
+
     template <typename number, typename timeunit>
     void Map<number,timeunit>::kernel(Space<number,timeunit>& kernel) const {
-        Matrix<number,timeunit>::kernel(kernel);
+        Space<number,timeunit> image;
+        decompose(kernel, image);
     }
 
 
@@ -71,7 +84,7 @@ namespace toprep {
 
         intervals.reserve(rows);
         for (int rowN = 0; rowN < rows; rowN++) {
-            intervals.push_back({ Matrix<number,timeunit>::getRowTime(rowN), tstep::INF });
+            intervals.push_back({ Matrix<number,timeunit>::getRowTime(rowN), timeunit::INF });
         }
 
         for (int colN = 0; colN < cols; colN++) {
@@ -81,91 +94,86 @@ namespace toprep {
     }
 
     template <typename number, typename timeunit>
-    Map<number,timeunit> Map<number,timeunit>::operator +(const Map<number,timeunit>& other) const {
-        ASSERT(Mat::row_times == other.row_times);
-
-        Map<number,timeunit> result(Mat::rows(), Mat::cols() + other.cols());
-        int i = 0, j = 0;
-        while (i < Mat::cols() && j < other.cols()) {
-            const timeunit timeA = Mat::getColTime(i);
-            const timeunit timeB = other.getColTime(j);
-            if (timeA <= timeB) {
-                const int colN = i + j;
-                result.mat[colN] = Mat::mat[i];
-                result.col_times[colN] = timeA;
-                ++i;
-            }
-            if (timeB <= timeA) {
-                const int colN = i + j;
-                result.mat[colN] = other.mat[j];
-                result.col_times[colN] = timeB;
-                ++j;
-            }
-        }
-        while (i < Mat::cols()) {
-            const int colN = i + j;
-            result.mat[colN] = Mat::mat[i];
-            result.col_times[colN] = Mat::getColTime(i);
-            ++i;
-        }
-        while (j < other.cols()) {
-            const int colN = i + j;
-            result.mat[colN] = other.mat[j];
-            result.col_times[colN] = other.getColTime(j);
-            ++j;
+    void Map<number,timeunit>::getDomainImgTimeDiffs(std::vector<std::pair<timeunit,timeunit>>& intervals,
+            const timeunit& min_persistence) const {
+        ASSERT(isReducedForm());
+
+        const int rows = Matrix<number,timeunit>::rows();
+        const int cols = Matrix<number,timeunit>::cols();
+
+        std::vector<int> killers(rows, -1);
+        for (int colN = 0; colN < cols; colN++) {
+            const int killedN = Matrix<number,timeunit>::operator [](colN).pivotDim();
+            if (killedN >= 0) { killers[killedN] = colN; }
         }
 
-        // copy the row times (they should be the same for all the maps)
-        result.row_times = Mat::row_times;
+        intervals.clear();
+        for (int rowN = 0; rowN < rows; rowN++) {
+            const timeunit birth = Matrix<number,timeunit>::getRowTime(rowN);
+            if (killers[rowN] == -1) {
+                intervals.push_back({ birth, timeunit::INF });
+                continue;
+            }
 
-        result.reduce(true);
+            const timeunit death = Matrix<number,timeunit>::getColTime(killers[rowN]);
+            if (birth < death && min_persistence <= death - birth) { intervals.push_back({ birth, death }); }
+        }
+    }
 
+    template <typename number, typename timeunit>
+    Map<number,timeunit> Map<number,timeunit>::operator +(const Map<number,timeunit>& other) const {
+        Map<number,timeunit> result;
+        Mat::mergeReduced(other, 1, result);
         return result;
     }
 
     template <typename number, typename timeunit>
     Map<number,timeunit> Map<number,timeunit>::operator -(const Map<number,timeunit>& other) const {
-        ASSERT(Mat::row_times == other.row_times);
-
-        Map<number,timeunit> result(Mat::rows(), Mat::cols() + other.cols());
-        int i = 0, j = 0;
-        while (i < Mat::cols() && j < other.cols()) {
-            const timeunit timeA = Mat::getColTime(i);
-            const timeunit timeB = other.getColTime(j);
-            if (timeA <= timeB) {
-                const int colN = i + j;
-                result.mat[colN] = Mat::mat[i];
-                result.col_times[colN] = Mat::timeA;
-                ++i;
-            }
-            if (timeB <= timeA) {
-                const int colN = i + j;
-                result.mat[colN] = other.mat[j];
-                result.mat[colN].makeNegative();
-                result.col_times[colN] = timeB;
-                ++j;
+        Map<number,timeunit> result;
+        Mat::mergeReduced(other, -1, result);
+        return result;
+    }
+
+    template <typename number,typename timeunit>
+    template <typename tmunit>
+    Map<number,tmunit> Map<number,timeunit>::retime(const std::vector<tmunit>& row_times,
+            const std::vector<tmunit>& col_times) const {
+        ASSERT(!hasMasks());
+        ASSERT(int(row_times.size()) == rows() && int(col_times.size()) == cols());
+
+        Map<number,tmunit> result(rows(), cols(), row_times, col_times);
+        for (int colN = 0; colN < cols(); colN++) {
+            // the entries are already sorted
+            for (const auto& entry : Mat::operator [](colN).getVector()) {
+                result.lazyAppend(entry.first, colN, entry.second);
             }
         }
-        while (i < Mat::cols()) {
-            const int colN = i + j;
-            result.mat[colN] = Mat::mat[i];
-            result.col_times[colN] = Mat::getColTime(i);
-            ++i;
-        }
-        while (j < other.cols()) {
-            const int colN = i + j;
-            result.mat[colN] = other.mat[j];
-            result.mat[colN].makeNegative();
-            result.col_times[colN] = other.getColTime(j);
-            ++j;
-        }
-
-        // copy the row times (they should be the same for all the maps)
-        result.row_times = Mat::row_times;
+        return result;
+    }
 
-        // reduce the result
-        result.reduce(true);
+    template <typename number,typename timeunit>
+    template <typename tmunit>
+    Map<number,tmunit> Map<number,timeunit>::permute(const std::vector<int>& order,
+            const std::vector<tmunit>& times) const {
+        ASSERT(!hasMasks());
+        ASSERT(rows() == cols());
+        ASSERT(int(order.size()) == cols() && int(times.size()) == cols());
+
+        const int size = cols();
+        std::vector<int> position(size);
+        for (int i = 0; i < size; i++) { position[order[i]] = i; }
+
+        Map<number,tmunit> result(size, size, times, times);
+        la::Vector<number,tmunit> column(size);
+        for (int colN = 0; colN < size; colN++) {
+            column.makeZero();
+            for (const auto& entry : Mat::operator [](order[colN]).getVector()) {
+                column.pushBack(position[entry.first], entry.second);
+            }
+            column.sort();
 
+            for (const auto& entry : column) { result.lazyAppend(entry.first, colN, entry.second); }
+        }
         return result;
     }
 
@@ -181,8 +189,20 @@ namespace toprep {
 
     template <typename number,typename timeunit>
     Module<number,timeunit>::Module(const Map<number,timeunit>& boundry) {
-        boundry.decompose(generators, relations);
+        // the apparent pairs need no column operations (most of the pairs of a
+        // Delaunay or Rips filtration are apparent)
+        std::vector<std::pair<int,int>> apparent;  boundry.apparentPairs(apparent);
+        boundry.decompose(generators, relations, {}, apparent);
         Map<number,timeunit>::find(generators, map, relations);
+        STATS_DUMP();
+    }
+
+    template <typename number,typename timeunit>
+    Module<number,timeunit>::Module(const Map<number,timeunit>& boundry, const std::vector<int>& subcomplex) {
+        std::vector<std::pair<int,int>> apparent;  boundry.apparentPairs(apparent);
+        boundry.decompose(generators, relations, subcomplex, apparent);
+        Map<number,timeunit>::find(generators, map, relations);
+        STATS_DUMP();
     }
 
     template <typename number,typename timeunit>
@@ -190,11 +210,68 @@ namespace toprep {
         map.getDomainImgTimeDiffs(barcode);
     }
 
+    template <typename number,typename timeunit>
+    void Module<number,timeunit>::getBarcode(std::vector<std::pair<timeunit,timeunit>>& barcode,
+            const timeunit& min_persistence) const {
+        map.getDomainImgTimeDiffs(barcode, min_persistence);
+    }
+
+    template <typename number, typename timeunit>
+    void relativeHomology(const Map<number,timeunit>& boundry, const std::vector<int>& subcomplex,
+            std::vector<std::pair<timeunit,timeunit>>& barcode) {
+        const Module<number,timeunit> module(boundry, subcomplex);
+        module.getBarcode(barcode);
+    }
+
+    template <typename number, typename timeunit>
+    Map<number,tstep> rank(const Map<number,timeunit>& map, std::vector<timeunit>& values) {
+        const int rows = map.rows();
+        const int cols = map.cols();
+
+        values.clear();
+        values.reserve(rows + cols);
+        for (int rowN = 0; rowN < rows; rowN++) { values.push_back(map.getRowTime(rowN)); }
+        for (int colN = 0; colN < cols; colN++) { values.push_back(map.getColTime(colN)); }
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        ASSERT(values.size() < size_t(tstep::UNDEFINED));
+
+        const auto rankOf = [&](const timeunit& time) {
+            return tstep(std::lower_bound(values.begin(), values.end(), time) - values.begin());
+        };
+
+        std::vector<tstep> row_ranks(rows);
+        std::vector<tstep> col_ranks(cols);
+        for (int rowN = 0; rowN < rows; rowN++) { row_ranks[rowN] = rankOf(map.getRowTime(rowN)); }
+        for (int colN = 0; colN < cols; colN++) { col_ranks[colN] = rankOf(map.getColTime(colN)); }
+        return map.retime(row_ranks, col_ranks);
+    }
+
+    template <typename timeunit>
+    void unrank(const std::vector<std::pair<tstep,tstep>>& ranks, const std::vector<timeunit>& values,
+            std::vector<std::pair<timeunit,timeunit>>& barcode) {
+        const auto value = [&](const tstep& rank) {
+            if (rank.isInfinity()) { return timeunit(timeunit::INF); }
+
+            DEBUG_ASSERT(0 <= rank.step() && rank.step() < int(values.size()));
+            return values[rank.step()];
+        };
+
+        barcode.clear();
+        barcode.reserve(ranks.size());
+        for (const std::pair<tstep,tstep>& bar : ranks) {
+            barcode.push_back({ value(bar.first), value(bar.second) });
+        }
+    }
+
     template <typename number, typename timeunit>
-    void relativeHomology(const Module<number,timeunit>& m1, const Map<number,timeunit>& f,
-            const Module<number,timeunit>& m2, const Map<number,timeunit>& g,
-            const Module<number,timeunit>& m3, Module<number,timeunit>& result) {
-        // 1) compute the generators
-        (f - g).kernel(result.generators);
+    void rankedBarcode(const Map<number,timeunit>& boundry, std::vector<std::pair<timeunit,timeunit>>& barcode) {
+        std::vector<timeunit> values;
+        std::vector<std::pair<tstep,tstep>> ranks;
+        {
+            const Module<number,tstep> module(rank(boundry, values));
+            module.getBarcode(ranks);
+        }
+        unrank(ranks, values, barcode);
     }
 }
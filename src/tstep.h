@@ -1,55 +1,91 @@
 #ifndef _TSTEP_H
 #define _TSTEP_H
 
+#include <cstdint>
 #include <iostream>
 #include <limits>
+#include <type_traits>
 
 #include "except.h"
 
 
 namespace ts {
 
-    class tstep {
+    /// the sentinels of the time steps. The integers use the two largest values
+    /// (so infinity is above all the finite times), the floating point types
+    /// use infinity and NaN.
+    template <typename T, bool = std::is_floating_point<T>::value>
+    struct TimePolicy {
+        static constexpr T INF = std::numeric_limits<T>::max();
+        static constexpr T UNDEFINED = std::numeric_limits<T>::max()-1;
+
+        static constexpr bool isUndefined(const T& ts) { return ts == UNDEFINED; }
+    };
+
+    template <typename T>
+    struct TimePolicy<T,true> {
+        static constexpr T INF = std::numeric_limits<T>::infinity();
+        static constexpr T UNDEFINED = std::numeric_limits<T>::quiet_NaN();
+
+        // NaN is the only value which differs from itself
+        static constexpr bool isUndefined(const T& ts) { return ts != ts; }
+    };
+
+    /// a time step of a filtration, T is the type of the values. The comparisons
+    /// only compare the values (the sentinels are checked in the debug build).
+    template <typename T, typename Policy = TimePolicy<T>>
+    class timestep {
     private:
-        int ts;
+        T ts;
 
     public:
-        using val_type = int;
+        using val_type = T;
 
-        static constexpr int INF= std::numeric_limits<decltype(ts)>::max();
-        static constexpr int UNDEFINED = std::numeric_limits<decltype(ts)>::max()-1;
+        static constexpr T INF = Policy::INF;
+        static constexpr T UNDEFINED = Policy::UNDEFINED;
 
         /// default constructor (sets to undefined if called without an argument)
-        constexpr tstep(const int& ts=UNDEFINED);
+        constexpr timestep(const T& ts=UNDEFINED);
 
-        constexpr int step() const { return ts; }
+        constexpr T step() const { return ts; }
 
         constexpr bool isUndefined() const;
         constexpr bool isInfinity() const;
 
 
         /// comparison operator
-        constexpr bool operator ==(const tstep&) const;
-        constexpr bool operator ==(const int&) const;
-        constexpr bool operator !=(const tstep&) const;
-        constexpr bool operator <(const tstep&) const;
-        constexpr bool operator <=(const tstep&) const;
+        constexpr bool operator ==(const timestep&) const;
+        constexpr bool operator ==(const T&) const;
+        constexpr bool operator !=(const timestep&) const;
+        constexpr bool operator <(const timestep&) const;
+        constexpr bool operator <=(const timestep&) const;
 
         /// arithmetic operators
-        constexpr tstep operator +(const tstep&) const;
-        constexpr tstep operator -(const tstep&) const;
+        constexpr timestep operator +(const timestep&) const;
+        constexpr timestep operator -(const timestep&) const;
 
         // XXX think about renaming these
-        constexpr bool canMultiplyBy(const tstep&) const;
-        constexpr bool canAddBy(const tstep&) const;
+        constexpr bool canMultiplyBy(const timestep&) const;
+        constexpr bool canAddBy(const timestep&) const;
 
-        constexpr bool canMultiplyTo(const tstep&) const;
-        constexpr bool canAddTo(const tstep&) const;
+        constexpr bool canMultiplyTo(const timestep&) const;
+        constexpr bool canAddTo(const timestep&) const;
     };
 
-    constexpr bool operator ==(const int&, const tstep&);
+    template <typename T, typename Policy>
+    constexpr bool operator ==(const typename timestep<T,Policy>::val_type&, const timestep<T,Policy>&);
+
+    template <typename T, typename Policy>
+    std::ostream& operator <<(std::ostream& os, const timestep<T,Policy>& ts);
 
-    std::ostream& operator <<(std::ostream& os, const tstep& ts);
+    // type aliases
+    using tstep = timestep<int>;
+    using tstepdouble = timestep<double>;
+    // the narrower and wider time steps
+    using tstep16 = timestep<std::uint16_t>;
+    using tstep32 = timestep<std::uint32_t>;
+    using tstep64 = timestep<std::int64_t>;
+    using tstepfloat = timestep<float>;
 
 }
 
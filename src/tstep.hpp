@@ -1,65 +1,102 @@
 namespace ts {
-    	
-    constexpr tstep::tstep(const int& _ts) : ts(_ts) {}
 
-    constexpr bool tstep::isUndefined() const {
-        return ts == UNDEFINED;
+    template <typename T, bool floating>
+    constexpr T TimePolicy<T,floating>::INF;
+    template <typename T, bool floating>
+    constexpr T TimePolicy<T,floating>::UNDEFINED;
+    template <typename T>
+    constexpr T TimePolicy<T,true>::INF;
+    template <typename T>
+    constexpr T TimePolicy<T,true>::UNDEFINED;
+
+    template <typename T, typename Policy>
+    constexpr T timestep<T,Policy>::INF;
+    template <typename T, typename Policy>
+    constexpr T timestep<T,Policy>::UNDEFINED;
+
+    template <typename T, typename Policy>
+    constexpr timestep<T,Policy>::timestep(const T& _ts) : ts(_ts) {}
+
+    template <typename T, typename Policy>
+    constexpr bool timestep<T,Policy>::isUndefined() const {
+        return Policy::isUndefined(ts);
     }
 
-    constexpr bool tstep::isInfinity() const {
+    template <typename T, typename Policy>
+    constexpr bool timestep<T,Policy>::isInfinity() const {
         return ts == INF;
     }
 
 
-    constexpr bool tstep::operator ==(const tstep& other) const {
+    template <typename T, typename Policy>
+    constexpr bool timestep<T,Policy>::operator ==(const timestep& other) const {
         return ts == other.ts;
     }
 
-    constexpr bool tstep::operator ==(const int& other) const {
+    template <typename T, typename Policy>
+    constexpr bool timestep<T,Policy>::operator ==(const T& other) const {
         return ts == other;
     }
 
-    constexpr bool tstep::operator !=(const tstep& other) const {
+    template <typename T, typename Policy>
+    constexpr bool timestep<T,Policy>::operator !=(const timestep& other) const {
         return ts != other.ts;
     }
 
-    constexpr bool tstep::operator <(const tstep& other) const {
+    template <typename T, typename Policy>
+    constexpr bool timestep<T,Policy>::operator <(const timestep& other) const {
         DEBUG_ASSERT(!isUndefined() && !other.isUndefined());
         return ts < other.ts;
     }
 
-    constexpr bool tstep::operator <=(const tstep& other) const {
+    template <typename T, typename Policy>
+    constexpr bool timestep<T,Policy>::operator <=(const timestep& other) const {
         DEBUG_ASSERT(!isUndefined() && !other.isUndefined());
         return ts <= other.ts;
     }
 
-    constexpr tstep tstep::operator +(const tstep& other) const {
+    template <typename T, typename Policy>
+    constexpr timestep<T,Policy> timestep<T,Policy>::operator +(const timestep& other) const {
         DEBUG_ASSERT(!isUndefined() && !other.isUndefined());
         return ts + other.ts;
     }
 
-    constexpr tstep tstep::operator -(const tstep& other) const {
+    template <typename T, typename Policy>
+    constexpr timestep<T,Policy> timestep<T,Policy>::operator -(const timestep& other) const {
         DEBUG_ASSERT(!isUndefined() && !other.isUndefined());
         return ts - other.ts;
     }
 
-    constexpr bool tstep::canMultiplyBy(const tstep& other) const {
+    template <typename T, typename Policy>
+    constexpr bool timestep<T,Policy>::canMultiplyBy(const timestep& other) const {
         return other <= *this;
     }
 
-    constexpr bool tstep::canAddBy(const tstep& other) const {
+    template <typename T, typename Policy>
+    constexpr bool timestep<T,Policy>::canAddBy(const timestep& other) const {
         return other <= *this;
     }
 
-    constexpr bool tstep::canMultiplyTo(const tstep& other) const {
+    template <typename T, typename Policy>
+    constexpr bool timestep<T,Policy>::canMultiplyTo(const timestep& other) const {
         return *this <= other;
     }
 
-    constexpr bool tstep::canAddTo(const tstep& other) const {
+    template <typename T, typename Policy>
+    constexpr bool timestep<T,Policy>::canAddTo(const timestep& other) const {
         return *this <= other;
     }
 
-    constexpr bool operator ==(const int& val, const tstep& ts) {
+    template <typename T, typename Policy>
+    constexpr bool operator ==(const typename timestep<T,Policy>::val_type& val, const timestep<T,Policy>& ts) {
         return ts == val;
     }
+
+    template <typename T, typename Policy>
+    std::ostream& operator <<(std::ostream& os, const timestep<T,Policy>& ts) {
+        if (ts.isUndefined()) { os << "undefined"; }
+        else if (ts.isInfinity()) { os << "inf"; }
+        else { os << "t" << +ts.step(); }
+        return os;
+    }
 }
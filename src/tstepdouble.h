@@ -1,57 +1,7 @@
 #ifndef _TSTEPDOUBLE_H
 #define _TSTEPDOUBLE_H
 
-#include <iostream>
-#include <limits>
-
-#include "except.h"
-
-
-namespace ts {
-    class tstepdouble {
-    private:
-        double ts;
-
-    public:
-        using val_type = double;
-
-        static constexpr double INF= std::numeric_limits<decltype(ts)>::infinity();
-        static constexpr double UNDEFINED = std::numeric_limits<decltype(ts)>::quiet_NaN();
-
-        /// default constructor (sets to undefined if called without an argument)
-        constexpr tstepdouble(const double& ts=UNDEFINED);
-
-        constexpr double step() const { return ts; }
-
-        constexpr bool isUndefined() const;
-        constexpr bool isInfinity() const;
-
-
-        /// comparison operator
-        constexpr bool operator ==(const tstepdouble&) const;
-        constexpr bool operator ==(const double&) const;
-        constexpr bool operator !=(const tstepdouble&) const;
-        constexpr bool operator <(const tstepdouble&) const;
-        constexpr bool operator <=(const tstepdouble&) const;
-
-        /// arithmetic operators
-        constexpr tstepdouble operator +(const tstepdouble&) const;
-        constexpr tstepdouble operator -(const tstepdouble&) const;
-
-        // XXX think about renaming these
-        constexpr bool canMultiplyBy(const tstepdouble&) const;
-        constexpr bool canAddBy(const tstepdouble&) const;
-
-        constexpr bool canMultiplyTo(const tstepdouble&) const;
-        constexpr bool canAddTo(const tstepdouble&) const;
-    };
-
-    constexpr bool operator ==(const double&, const tstepdouble&);
-
-    std::ostream& operator <<(std::ostream& os, const tstepdouble& ts);
-
-}
-
-#include "tstepdouble.hpp"
+// ts::tstepdouble is the double instance of ts::timestep
+#include "tstep.h"
 
 #endif
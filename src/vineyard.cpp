@@ -0,0 +1 @@
+#include "vineyard.h"
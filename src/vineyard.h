@@ -0,0 +1,96 @@
+#ifndef _VINEYARD_H
+#define _VINEYARD_H
+
+#include <vector>
+
+#include "topology.h"
+#include "toprep.h"
+#include "stats.h"
+
+namespace toprep {
+
+    ////////////////////////////////////////
+    /// Vineyard: the persistence of a filtration whose times change. The boundary
+    /// is kept reduced as R = D*V (V upper triangular) and a change of the times
+    /// reorders the filtration by transpositions of neighboring simplices, each of
+    /// which only touches the columns containing the two simplices (Cohen-Steiner,
+    /// Edelsbrunner and Morozov), instead of reducing the boundary again. The
+    /// columns are found through an index of the rows, and an update which would
+    /// need too many transpositions (compared to the entries of R and V) reduces
+    /// the new order from scratch instead.
+    template <typename number,typename timeunit=tstep>
+    class Vineyard {
+    private:
+        using Vec = la::Vector<number,timeunit>;
+
+        // by the positions in the current order
+        std::vector<Vec> R;
+        std::vector<Vec> V;
+        std::vector<int> pivot_cols;    // the column with the low in the row or -1
+        std::vector<int> ids;           // the simplex at the position
+        // the simplices of the columns with an entry in the row, the list may hold
+        // columns which lost the entry since (they are dropped when it is read)
+        std::vector<std::vector<int>> R_rows;
+        std::vector<std::vector<int>> V_rows;
+
+        // by the simplices (their index in the initial filtration)
+        std::vector<int> positions;
+        std::vector<timeunit> times;
+        std::vector<int> dims;
+        std::vector<Vec> boundaries;    // the rows are the simplices as well
+
+        long transpositions;
+        long rebuilds;
+        // marks the simplices already collected from a row
+        std::vector<long> marks;
+        long mark;
+
+        /// reduces the boundary in the order of ids from scratch
+        void rebuild();
+        void reduce();
+        /// makes the low of the column unique, reducing it (or the later column
+        /// sharing its low) by the earlier ones
+        void fixPivot(int colN);
+        /// adds k times the earlier column to the later one (in R and in V)
+        void addColumn(const int& later, const int& earlier, const number& k);
+        /// the positions of the columns of M with an entry in the row, the stale
+        /// simplices are dropped from the list
+        void columnsWith(const std::vector<Vec>& M, std::vector<int>& list, const int& rowN, std::vector<int>& columns);
+        /// swaps the simplices at the positions i and i+1
+        void transpose(const int& i);
+        // the order of the filtration: the faces come before their cofaces at the same time
+        bool before(const int& a, const int& b) const;
+        bool beforeSimplex(const int& a, const int& b) const;
+
+    public:
+        using time_type = timeunit;
+        using val_type = number;
+
+        /// reduces the boundary of the finalized complex
+        template <typename indextype>
+        explicit Vineyard(top::Complex<timeunit,indextype>& C);
+
+        /// changes the times of the simplices (given by their index in the complex),
+        /// the faces still have to appear no later than their cofaces. The simplices
+        /// are moved by the least number of transpositions (the inversions of the
+        /// order), unless reducing the new order from scratch is cheaper.
+        void update(const std::vector<std::pair<int,timeunit>>& changes);
+
+        /// the barcode of the current times, a bar for every positive simplex in
+        /// the order of the filtration (as Module::getBarcode)
+        void getBarcode(std::vector<std::pair<timeunit,timeunit>>&) const;
+
+        int size() const { return ids.size(); }
+        /// the position of the simplex in the current order
+        int position(const int& simplexN) const { return positions[simplexN]; }
+        timeunit getTime(const int& simplexN) const { return times[simplexN]; }
+        /// the number of transpositions done by the updates so far
+        long transpositionCount() const { return transpositions; }
+        /// the number of updates which reduced the new order from scratch
+        long rebuildCount() const { return rebuilds; }
+    };
+}
+
+#include "vineyard.hpp"
+
+#endif
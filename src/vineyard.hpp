@@ -0,0 +1,259 @@
+#include <numeric>
+#include <algorithm>
+
+namespace toprep {
+
+    template <typename number,typename timeunit>
+    template <typename indextype>
+    Vineyard<number,timeunit>::Vineyard(top::Complex<timeunit,indextype>& C):
+            transpositions(0),
+            rebuilds(0),
+            mark(0) {
+        ASSERT(C.is_finalized());
+        const int size = C.size();
+
+        ids.resize(size);
+        positions.resize(size);
+        times.resize(size);
+        dims.resize(size);
+        boundaries.assign(size, Vec(size));
+        marks.assign(size, 0);
+
+        for (int simplexN = 0; simplexN < size; simplexN++) {
+            ids[simplexN] = simplexN;
+            times[simplexN] = C.getTime(simplexN);
+            dims[simplexN] = C[simplexN].dim();
+
+            // the same signs as top::boundary
+            number coeff = -1;
+            for (int j = 0; j <= dims[simplexN] && dims[simplexN] > 0; j++) {
+                boundaries[simplexN].pushBack(C.getIndex(C[simplexN].erase(j)), coeff);
+                coeff = coeff * number(-1);
+            }
+            boundaries[simplexN].sort();
+        }
+        rebuild();
+    }
+
+    template <typename number,typename timeunit>
+    void Vineyard<number,timeunit>::rebuild() {
+        const int size = ids.size();
+        for (int posN = 0; posN < size; posN++) { positions[ids[posN]] = posN; }
+
+        R.assign(size, Vec(size));
+        V.assign(size, Vec(size));
+        for (int posN = 0; posN < size; posN++) {
+            for (const auto& entry : boundaries[ids[posN]]) { R[posN].pushBack(positions[entry.first], entry.second); }
+            R[posN].sort();
+            V[posN].pushBack(posN, 1);
+        }
+        pivot_cols.assign(size, -1);
+
+        // the rows are indexed once the reduction is done
+        R_rows.clear();
+        V_rows.clear();
+        reduce();
+
+        R_rows.assign(size, {});
+        V_rows.assign(size, {});
+        for (int posN = 0; posN < size; posN++) {
+            for (const auto& entry : R[posN]) { R_rows[entry.first].push_back(ids[posN]); }
+            for (const auto& entry : V[posN]) { V_rows[entry.first].push_back(ids[posN]); }
+        }
+    }
+
+    template <typename number,typename timeunit>
+    void Vineyard<number,timeunit>::reduce() {
+        STATS_PHASE(Decompose);
+        for (int colN = 0; colN < int(R.size()); colN++) { fixPivot(colN); }
+    }
+
+    template <typename number,typename timeunit>
+    void Vineyard<number,timeunit>::addColumn(const int& later, const int& earlier, const number& k) {
+        R[later].addMultiple(R[earlier], k);
+        V[later].addMultiple(V[earlier], k);
+        if (R_rows.empty()) { return; }
+
+        // the rows of the later column can only have gained the entries of the earlier one
+        for (const auto& entry : R[earlier]) { R_rows[entry.first].push_back(ids[later]); }
+        for (const auto& entry : V[earlier]) { V_rows[entry.first].push_back(ids[later]); }
+    }
+
+    template <typename number,typename timeunit>
+    void Vineyard<number,timeunit>::fixPivot(int colN) {
+        while (!R[colN].isZero()) {
+            const int low = R[colN].pivotDim();
+            const int other = pivot_cols[low];
+            if (other == -1 || other == colN) {
+                pivot_cols[low] = colN;
+                return;
+            }
+
+            // the later column is reduced by the earlier one, so V stays upper triangular
+            const int earlier = std::min(colN, other);
+            const int later = std::max(colN, other);
+            addColumn(later, earlier, -R[later].pivot() * R[earlier].pivot().inverse());
+
+            pivot_cols[low] = earlier;
+            colN = later;
+        }
+    }
+
+    namespace detail {
+        // a transposition costs about as much as this many entries of a reduction from
+        // scratch (the columns of the two rows are looked up and rewritten)
+        constexpr long TRANSPOSITION_COST = 8;
+
+        // the first entry of the (sorted) column in a row not before the given one
+        template <typename Iterator>
+        Iterator findRow(const Iterator& begin, const Iterator& end, const int& rowN) {
+            return std::lower_bound(begin, end, rowN,
+                    [](const typename Iterator::value_type& entry, const int& row) { return entry.first < row; });
+        }
+    }
+
+    template <typename number,typename timeunit>
+    void Vineyard<number,timeunit>::columnsWith(const std::vector<Vec>& M, std::vector<int>& list, const int& rowN,
+            std::vector<int>& columns) {
+        ++mark;
+        size_t kept = 0;
+        for (const int& simplexN : list) {
+            if (marks[simplexN] == mark) { continue; }
+
+            const Vec& col = M[positions[simplexN]];
+            const auto entry = detail::findRow(col.begin(), col.end(), rowN);
+            if (entry != col.end() && entry->first == rowN) {
+                marks[simplexN] = mark;
+                list[kept++] = simplexN;
+                columns.push_back(positions[simplexN]);
+            }
+        }
+        list.resize(kept);
+    }
+
+    template <typename number,typename timeunit>
+    bool Vineyard<number,timeunit>::before(const int& a, const int& b) const {
+        return beforeSimplex(ids[a], ids[b]);
+    }
+
+    template <typename number,typename timeunit>
+    bool Vineyard<number,timeunit>::beforeSimplex(const int& a, const int& b) const {
+        if (times[a] == times[b]) { return dims[a] < dims[b]; }
+        return times[a] < times[b];
+    }
+
+    template <typename number,typename timeunit>
+    void Vineyard<number,timeunit>::transpose(const int& i) {
+        const int a = i, b = i+1;
+        // a face can not be moved after its coface
+        DEBUG_ASSERT(boundaries[ids[b]][ids[a]] == 0);
+
+        // the columns whose lows might collide after the swap
+        std::vector<int> affected = { a, b };
+        if (pivot_cols[a] != -1) { affected.push_back(pivot_cols[a]); }
+        if (pivot_cols[b] != -1) { affected.push_back(pivot_cols[b]); }
+        for (const int& colN : affected) {
+            if (!R[colN].isZero() && pivot_cols[R[colN].pivotDim()] == colN) { pivot_cols[R[colN].pivotDim()] = -1; }
+        }
+
+        // V stays upper triangular after the swap only without the entry V[a][b]
+        const auto v_entry = detail::findRow(V[b].begin(), V[b].end(), a);
+        if (v_entry != V[b].end() && v_entry->first == a) { addColumn(b, a, -v_entry->second); }
+
+        // swap the rows a and b (they are neighbors, so the entries stay sorted) in the
+        // columns which have an entry in any of them
+        const auto swapRows = [&](Vec& col) {
+            const auto entry = detail::findRow(col.begin(), col.end(), a);
+            if (entry == col.end()) { return; }
+            if (entry->first == a) {
+                const auto next = entry + 1;
+                if (next != col.end() && next->first == b) { std::swap(entry->second, next->second); }
+                else { entry->first = b; }
+            }
+            else if (entry->first == b) { entry->first = a; }
+        };
+        std::vector<int> columns;
+        columnsWith(R, R_rows[a], a, columns);
+        columnsWith(R, R_rows[b], b, columns);
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+        for (const int& colN : columns) { swapRows(R[colN]); }
+
+        columns.clear();
+        columnsWith(V, V_rows[a], a, columns);
+        columnsWith(V, V_rows[b], b, columns);
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+        for (const int& colN : columns) { swapRows(V[colN]); }
+
+        std::swap(R_rows[a], R_rows[b]);
+        std::swap(V_rows[a], V_rows[b]);
+
+        // and the columns
+        std::swap(R[a], R[b]);
+        std::swap(V[a], V[b]);
+        std::swap(ids[a], ids[b]);
+        positions[ids[a]] = a;
+        positions[ids[b]] = b;
+        for (int& colN : affected) {
+            if (colN == a) { colN = b; }
+            else if (colN == b) { colN = a; }
+        }
+
+        std::sort(affected.begin(), affected.end());
+        affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+        for (const int& colN : affected) { fixPivot(colN); }
+        transpositions++;
+    }
+
+    template <typename number,typename timeunit>
+    void Vineyard<number,timeunit>::update(const std::vector<std::pair<int,timeunit>>& changes) {
+        for (const std::pair<int,timeunit>& change : changes) {
+            times[change.first] = change.second;
+        }
+
+        // the new order (the ties keep their order) and the number of its inversions,
+        // which is the number of the transpositions
+        const int n = size();
+        std::vector<int> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](const int& a, const int& b) { return before(a, b); });
+
+        long inversions = 0;
+        std::vector<int> counts(n + 1, 0);     // a fenwick tree of the positions seen so far
+        for (int k = 0; k < n; k++) {
+            int smaller = 0;
+            for (int j = order[k]; j > 0; j -= j & -j) { smaller += counts[j]; }
+            inversions += k - smaller;
+            for (int j = order[k] + 1; j <= n; j += j & -j) { counts[j]++; }
+        }
+        if (inversions == 0) { return; }
+
+        long entries = 0;
+        for (int posN = 0; posN < n; posN++) { entries += R[posN].size() + V[posN].size(); }
+        if (detail::TRANSPOSITION_COST * inversions > entries) {
+            std::vector<int> new_ids(n);
+            for (int k = 0; k < n; k++) { new_ids[k] = ids[order[k]]; }
+            ids.swap(new_ids);
+            rebuild();
+            rebuilds++;
+            return;
+        }
+
+        // insertion sort, it only swaps the inverted neighbors
+        for (int posN = 1; posN < n; posN++) {
+            for (int i = posN; i > 0 && before(i, i-1); i--) { transpose(i-1); }
+        }
+    }
+
+    template <typename number,typename timeunit>
+    void Vineyard<number,timeunit>::getBarcode(std::vector<std::pair<timeunit,timeunit>>& barcode) const {
+        barcode.clear();
+        for (int posN = 0; posN < size(); posN++) {
+            if (!R[posN].isZero()) { continue; }
+
+            const int killer = pivot_cols[posN];
+            barcode.push_back({ times[ids[posN]], killer == -1 ? timeunit(timeunit::INF) : times[ids[killer]] });
+        }
+    }
+}
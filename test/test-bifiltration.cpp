@@ -0,0 +1,105 @@
+#include <random>
+
+#include "bifiltration.h"
+#include "generators.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+    using Barcode = std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>>;
+
+    // the bars of positive length, sorted (the zero length bars depend on how the ties are broken)
+    Barcode positiveBars(const Barcode& barcode) {
+        Barcode result;
+        for (const auto& bar : barcode) {
+            if (bar.first < bar.second) { result.push_back(bar); }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // the barcode of the complex with the times given by the grades
+    template <typename Time>
+    Barcode sliceBarcode(const top::Complex<ts::bistepdouble,int>& B, const Time& time) {
+        top::Complex<ts::tstepdouble,int> C;
+        for (int i = 0; i < B.size(); i++) { C.insert(B[i], time(B.getTime(i))); }
+        C.finalize();
+
+        Barcode barcode;
+        toprep::Module<num::binary,ts::tstepdouble>(top::boundary<num::binary>(C)).getBarcode(barcode);
+        return positiveBars(barcode);
+    }
+}
+
+TEST(Bifiltration, bistep) {
+    constexpr ts::bistepdouble a(1, 2), b(2, 1), c(2, 3);
+    static_assert(a < b && !(b < a) && a <= a, "lexicographic");
+    static_assert(a.precedes(c) && b.precedes(c) && !a.precedes(b) && !b.precedes(a), "product order");
+    static_assert(a.join(b) == ts::bistepdouble(2, 2), "join");
+    static_assert(ts::bistepdouble().isUndefined() && !a.isUndefined(), "undefined");
+
+    const bifiltration::Line diagonal = { { 0, 0 }, { 1, 1 } };
+    ASSERT_EQ(3, bifiltration::push(diagonal, c));
+    const bifiltration::Line horizontal = { { 0, 2.5 }, { 2, 0 } };
+    ASSERT_EQ(0.5, bifiltration::push(horizontal, a));
+    ASSERT_TRUE(std::isinf(bifiltration::push(horizontal, c)));
+}
+
+// a Rips complex graded by the radius and the largest codensity of its vertices
+TEST(Bifiltration, fiberedBarcode) {
+    auto R = gen::ripsComplex(gen::uniformCloud(30, 2, 8), 0.35, 2);
+    R.finalize();
+
+    std::mt19937 gen(8);
+    std::uniform_real_distribution<double> unif(0, 1);
+    std::vector<double> codensity(30);
+    for (double& d : codensity) { d = unif(gen); }
+
+    top::Complex<ts::bistepdouble,int> B;
+    for (int i = 0; i < R.size(); i++) {
+        double y = 0;
+        for (const int& v : R[i]) { y = std::max(y, codensity[v]); }
+        B.insert(R[i], ts::bistepdouble(R.getTime(i).step(), y));
+    }
+    B.finalize();
+    ASSERT_TRUE(B.verify());
+
+    const std::vector<bifiltration::Line> lines = {
+        { { 0, 1 }, { 1, 0 } },         // the radius filtration of all the simplices
+        { { 0, 0.5 }, { 1, 0 } },       // of the ones with codensity up to 0.5
+        { { 0, 0 }, { 1, 1 } },
+        { { 0.1, 0 }, { 1, 2 } },
+        { { 0, 0 }, { 0, 1 } }
+    };
+
+    const int threads = parallel::threadCount();
+    parallel::setThreadCount(1);
+    std::vector<Barcode> serial;
+    bifiltration::fiberedBarcode<num::binary>(B, lines, serial);
+    parallel::setThreadCount(4);
+    std::vector<Barcode> barcodes;
+    bifiltration::fiberedBarcode<num::binary>(B, lines, barcodes);
+    parallel::setThreadCount(threads);
+
+    ASSERT_EQ(lines.size(), barcodes.size());
+    ASSERT_EQ(serial, barcodes);
+
+    for (size_t lineN = 0; lineN < lines.size(); lineN++) {
+        const bifiltration::Line& line = lines[lineN];
+        const auto push = [&](const ts::bistepdouble& grade) { return bifiltration::push(line, grade); };
+
+        // the simplices the line never reaches are removed
+        top::Complex<ts::bistepdouble,int> reached;
+        for (int i = 0; i < B.size(); i++) {
+            if (!std::isinf(push(B.getTime(i)))) { reached.insert(B[i], B.getTime(i)); }
+        }
+        reached.finalize();
+
+        ASSERT_FALSE(positiveBars(barcodes[lineN]).empty());
+        ASSERT_EQ(sliceBarcode(reached, push), positiveBars(barcodes[lineN]));
+    }
+
+    // the first line is the radius filtration
+    ASSERT_EQ(sliceBarcode(B, [](const ts::bistepdouble& grade) { return grade.first(); }),
+            positiveBars(barcodes[0]));
+}
@@ -119,3 +119,27 @@ for(auto i:bc){
 }
 
 
+
+
+TEST(Complex,RelativeBoundary){
+
+// a circle relative to one of its arcs
+Complex<ts::tstep,int> K = { { {0},0 }, {{1},0}, {{2},0}, {{0,1},1}, {{1,2},1}, {{0,2},2} };
+Complex<ts::tstep,int> L = { { {0},0 }, {{1},0}, {{0,1},1} };
+K.finalize();
+L.finalize();
+
+std::vector<int> subcomplex;
+subcomplexIndices(K,L,subcomplex);
+ASSERT_EQ(std::vector<int>({0,1,3}), subcomplex);
+
+auto D = relativeBoundary<ternary,ts::tstep>(K,L);
+
+std::vector<std::pair<ts::tstep,ts::tstep> > bc;
+toprep::relativeHomology(D,subcomplex,bc);
+
+ASSERT_EQ(bc.size(),2);
+ASSERT_TRUE(std::find(bc.begin(),bc.end(),std::make_pair(ts::tstep(0),ts::tstep(1)))!=bc.end());
+ASSERT_TRUE(std::find(bc.begin(),bc.end(),std::make_pair(ts::tstep(2),ts::tstep(ts::tstep::INF)))!=bc.end());
+
+}
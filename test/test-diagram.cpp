@@ -0,0 +1,104 @@
+#include <cmath>
+#include <random>
+#include <algorithm>
+
+#include "diagram.h"
+#include "toprep.h"
+#include "generators.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+    diagram::Diagram randomDiagram(const int& n, std::mt19937& gen) {
+        std::uniform_real_distribution<double> unif(0, 1);
+        diagram::Diagram result;
+        for (int i = 0; i < n; i++) {
+            const double birth = unif(gen);
+            result.push_back({ birth, birth + unif(gen) });
+        }
+        return result;
+    }
+
+    // goes through all the matchings of the points and the diagonal copies, returns the
+    // smallest maximum and the smallest sum of the p-th powers
+    std::pair<double,double> bruteForce(const diagram::Diagram& a, const diagram::Diagram& b, const double& p) {
+        const int n = a.size(), m = b.size();
+        const double inf = std::numeric_limits<double>::infinity();
+        std::vector<std::vector<double>> costs(n + m, std::vector<double>(n + m, 0));
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n + m; j++) {
+                costs[i][j] = j < m ? std::max(std::abs(a[i].first - b[j].first), std::abs(a[i].second - b[j].second))
+                                    : (j == m + i ? (a[i].second - a[i].first) / 2 : inf);
+            }
+        }
+        for (int j = 0; j < m; j++) {
+            for (int k = 0; k < m; k++) { costs[n + j][k] = k == j ? (b[j].second - b[j].first) / 2 : inf; }
+        }
+
+        std::vector<int> perm(n + m);
+        for (int i = 0; i < n + m; i++) { perm[i] = i; }
+        double max = inf, sum = inf;
+        do {
+            double perm_max = 0, perm_sum = 0;
+            for (int i = 0; i < n + m; i++) {
+                perm_max = std::max(perm_max, costs[i][perm[i]]);
+                perm_sum += std::pow(costs[i][perm[i]], p);
+            }
+            max = std::min(max, perm_max);
+            sum = std::min(sum, perm_sum);
+        } while (std::next_permutation(perm.begin(), perm.end()));
+        return { max, std::pow(sum, 1 / p) };
+    }
+}
+
+// compares the distances of small random diagrams to all the matchings
+TEST(Diagram, distances) {
+    std::mt19937 gen(5);
+    for (int test = 0; test < 40; test++) {
+        const diagram::Diagram a = randomDiagram(test % 4 + 1, gen), b = randomDiagram(test % 3 + 1, gen);
+        for (const double& p : { 1.0, 2.0 }) {
+            const std::pair<double,double> expected = bruteForce(a, b, p);
+            ASSERT_DOUBLE_EQ(expected.first, diagram::bottleneck(a, b));
+            const double distance = diagram::wasserstein(a, b, p, 0.01);
+            ASSERT_LE(expected.second - 1e-9, distance);
+            ASSERT_GE(expected.second * 1.01 + 1e-9, distance);
+        }
+    }
+
+    // the essential classes are matched among themselves
+    const double inf = std::numeric_limits<double>::infinity();
+    const diagram::Diagram a = { { 0, inf }, { 2, inf }, { 1, 1.5 } }, b = { { 0.5, inf }, { 3, inf } };
+    ASSERT_DOUBLE_EQ(1, diagram::bottleneck(a, b));
+    ASSERT_NEAR(1.75, diagram::wasserstein(a, b, 1, 1e-6), 1e-6);
+    ASSERT_TRUE(std::isinf(diagram::bottleneck(a, { { 0, inf } })));
+    ASSERT_DOUBLE_EQ(0, diagram::bottleneck(a, a));
+    ASSERT_DOUBLE_EQ(0, diagram::bottleneck({}, {}));
+}
+
+// the parallel matrices of the barcodes of random complexes
+TEST(Diagram, matrix) {
+    std::vector<diagram::Diagram> diagrams;
+    for (unsigned seed = 0; seed < 6; seed++) {
+        auto C = gen::ripsComplex(gen::uniformCloud(30, 2, seed), 0.3, 2);
+        C.finalize();
+        std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>> barcode;
+        toprep::Module<num::binary,ts::tstepdouble>(top::boundary<num::binary>(C)).getBarcode(barcode);
+        diagrams.push_back(diagram::fromBarcode(barcode));
+        for (const std::pair<double,double>& point : diagrams.back()) { ASSERT_LT(point.first, point.second); }
+    }
+
+    std::vector<double> bottleneck, wasserstein;
+    diagram::bottleneckMatrix(diagrams, bottleneck);
+    diagram::wassersteinMatrix(diagrams, 2, wasserstein);
+    const int n = diagrams.size();
+    ASSERT_EQ(size_t(n*n), bottleneck.size());
+    for (int i = 0; i < n; i++) {
+        ASSERT_EQ(0, bottleneck[i*n + i]);
+        for (int j = 0; j < n; j++) {
+            ASSERT_EQ(bottleneck[i*n + j], bottleneck[j*n + i]);
+            ASSERT_EQ(diagram::bottleneck(diagrams[i], diagrams[j]), bottleneck[i*n + j]);
+            ASSERT_EQ(diagram::wasserstein(diagrams[i], diagrams[j], 2), wasserstein[i*n + j]);
+            ASSERT_LE(bottleneck[i*n + j], wasserstein[i*n + j] + 1e-9);
+        }
+    }
+}
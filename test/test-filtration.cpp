@@ -0,0 +1,178 @@
+#include <random>
+
+#include "filtration.h"
+
+#include "gtest/gtest.h"
+
+TEST(Filtration, circumsphere) {
+    const double a[3] = { 0, 0, 0 }, b[3] = { 2, 0, 0 }, c[3] = { 0, 2, 0 }, d[3] = { 0, 0, 2 };
+    const double* points[4] = { a, b, c, d };
+    double center[3];
+
+    ASSERT_NEAR(1, meb::circumsphere<3>(points, 2, center), 1e-12);
+    ASSERT_NEAR(1, center[0], 1e-12);
+    ASSERT_NEAR(2, meb::circumsphere<3>(points, 3, center), 1e-12);
+    ASSERT_NEAR(0, center[2], 1e-12);
+    ASSERT_NEAR(3, meb::circumsphere<3>(points, 4, center), 1e-12);
+    ASSERT_NEAR(1, center[2], 1e-12);
+
+    // collinear points have no circumsphere
+    const double e[3] = { 4, 0, 0 };
+    const double* line[3] = { a, b, e };
+    ASSERT_EQ(std::numeric_limits<double>::infinity(), meb::circumsphere<3>(line, 3, center));
+}
+
+TEST(Filtration, alphaTriangle) {
+    const top::Simplex<int> tri = { 0, 1, 2 };
+
+    // the circumcenter of an acute triangle is inside it, all the faces are Gabriel
+    const double acute[6] = { 0, 0, 1, 0, 0.5, 1 };
+    auto C = filtration::alphaComplex<2>(acute, { { 0, 1, 2 } });
+    C.finalize();
+    ASSERT_EQ(7, C.size());
+    ASSERT_TRUE(C.verify());
+    ASSERT_NEAR(0.625, C.getTime(tri).step(), 1e-12);
+    ASSERT_NEAR(0.5, C.getTime(top::Simplex<int>({ 0, 1 })).step(), 1e-12);
+    ASSERT_EQ(0, C.getTime(top::Simplex<int>(2)).step());
+
+    // the third vertex of an obtuse triangle is inside the ball of the long edge,
+    // the edge is attached to the triangle and appears with it
+    const double obtuse[6] = { 0, 0, 2, 0, 1, 0.2 };
+    auto O = filtration::alphaComplex<2>(obtuse, { { 2, 0, 1 } });
+    O.finalize();
+    ASSERT_TRUE(O.verify());
+    const double radius = O.getTime(tri).step();
+    ASSERT_NEAR(std::sqrt(1.04*1.04 / 0.16), radius, 1e-9);
+    ASSERT_EQ(radius, O.getTime(top::Simplex<int>({ 0, 1 })).step());
+    ASSERT_NEAR(std::sqrt(1.04) / 2, O.getTime(top::Simplex<int>({ 1, 2 })).step(), 1e-12);
+}
+
+TEST(Filtration, alphaMonotone) {
+    // the Delaunay triangulation of a fan around the origin with random radii
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<double> unif(0.5, 1.5);
+
+    const int n = 12;
+    std::vector<double> coords = { 0, 0 };
+    std::vector<std::vector<int>> cells;
+    for (int i = 0; i < n; i++) {
+        const double angle = 2*M_PI*i / n;
+        const double r = unif(gen);
+        coords.push_back(r*std::cos(angle));
+        coords.push_back(r*std::sin(angle));
+        cells.push_back({ 0, 1 + i, 1 + (i+1) % n });
+    }
+
+    auto C = filtration::alphaComplex<2>(coords.data(), cells);
+    C.finalize();
+    ASSERT_EQ(1 + 2*n + n + n, C.size());
+    ASSERT_TRUE(C.verify());
+
+    for (int i = 0; i < C.size(); i++) {
+        const top::Simplex<int> simplex = C[i];
+        for (int j = 0; j <= simplex.dim() && simplex.dim() > 0; j++) {
+            ASSERT_LE(C.getTime(simplex.erase(j)).step(), C.getTime(i).step());
+        }
+
+        // the alpha value is never below the radius of the smallest enclosing ball
+        std::vector<const double*> points;
+        for (const int& v : simplex) { points.push_back(coords.data() + 2*v); }
+        ASSERT_GE(C.getTime(i).step() + 1e-12, std::sqrt(meb::squaredRadius<2>(points.data(), points.size())));
+    }
+}
+
+TEST(Filtration, cechParallel) {
+    std::mt19937 gen(9);
+    std::uniform_real_distribution<double> unif(0, 1);
+
+    // random simplices of all sizes up to 4 in 3D
+    const int n = 100;
+    std::vector<double> coords(3*n);
+    for (double& x : coords) { x = unif(gen); }
+
+    std::uniform_int_distribution<int> vertex(0, n-1);
+    std::vector<std::vector<int>> faces(4);
+    for (int k = 1; k <= 4; k++) {
+        for (int simplexN = 0; simplexN < 3000; simplexN++) {
+            std::vector<int> simplex;
+            while (int(simplex.size()) < k) {
+                const int v = vertex(gen);
+                if (std::find(simplex.begin(), simplex.end(), v) == simplex.end()) { simplex.push_back(v); }
+            }
+            faces[k-1].insert(faces[k-1].end(), simplex.begin(), simplex.end());
+        }
+    }
+
+    const int threads = parallel::threadCount();
+    parallel::setThreadCount(1);
+    auto serial = filtration::cechComplex<3>(coords.data(), faces);
+    parallel::setThreadCount(4);
+    auto parallel = filtration::cechComplex<3>(coords.data(), faces);
+    parallel::setThreadCount(threads);
+
+    ASSERT_EQ(4*3000, parallel.size());
+    serial.finalize();
+    parallel.finalize();
+    ASSERT_EQ(serial.size(), parallel.size());
+
+    for (int i = 0; i < parallel.size(); i++) {
+        ASSERT_EQ(serial[i], parallel[i]);
+        ASSERT_EQ(serial.getTime(i).step(), parallel.getTime(i).step());
+
+        std::vector<const double*> points;
+        for (const int& v : parallel[i]) { points.push_back(coords.data() + 3*v); }
+        ASSERT_NEAR(std::sqrt(meb::squaredRadius<3>(points.data(), points.size())), parallel.getTime(i).step(), 1e-12);
+    }
+}
+
+// the barcode of the ranks of the squared radii is the barcode of the radii
+TEST(Filtration, ranks) {
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> unif(0, 1);
+
+    // all the triangles on n random points in 3D
+    const int n = 12;
+    std::vector<double> coords(3*n);
+    for (double& x : coords) { x = unif(gen); }
+
+    std::vector<std::vector<int>> faces(3);
+    for (int a = 0; a < n; a++) {
+        faces[0].push_back(a);
+        for (int b = a+1; b < n; b++) {
+            faces[1].insert(faces[1].end(), { a, b });
+            for (int c = b+1; c < n; c++) { faces[2].insert(faces[2].end(), { a, b, c }); }
+        }
+    }
+
+    auto C = filtration::cechComplex<3>(coords.data(), faces);
+    auto S = filtration::cechComplex<3>(coords.data(), faces, filtration::Value::SquaredRadius);
+    std::vector<double> values;
+    auto R = filtration::rankComplex(S, values);
+    ASSERT_EQ(C.size(), R.size());
+    ASSERT_TRUE(std::is_sorted(values.begin(), values.end()));
+    ASSERT_EQ(0, values[0]);
+
+    C.finalize();   S.finalize();   R.finalize();
+    for (int i = 0; i < R.size(); i++) {
+        ASSERT_EQ(C[i], R[i]);
+        ASSERT_EQ(S.getTime(i).step(), values[R.getTime(i).step()]);
+    }
+
+    std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>> expected, squared, ranked;
+    toprep::Module<num::binary,ts::tstepdouble>(top::boundary<num::binary>(C)).getBarcode(expected);
+    toprep::Module<num::binary,ts::tstepdouble>(top::boundary<num::binary>(S)).getBarcode(squared);
+    std::vector<std::pair<ts::tstep,ts::tstep>> ranks;
+    toprep::Module<num::binary,ts::tstep>(top::boundary<num::binary>(R)).getBarcode(ranks);
+    filtration::toRadii(squared);
+    filtration::fromRanks(ranks, values, filtration::Value::SquaredRadius, ranked);
+
+    ASSERT_EQ(expected.size(), ranked.size());
+    ASSERT_EQ(expected.size(), squared.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        for (const auto& bar : { squared[i], ranked[i] }) {
+            ASSERT_NEAR(expected[i].first.step(), bar.first.step(), 1e-12);
+            ASSERT_EQ(expected[i].second.isInfinity(), bar.second.isInfinity());
+            if (!bar.second.isInfinity()) { ASSERT_NEAR(expected[i].second.step(), bar.second.step(), 1e-12); }
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#include "generators.h"
+
+#include "gtest/gtest.h"
+
+TEST(Generators, pointClouds) {
+    const gen::PointCloud cloud = gen::uniformCloud(100, 3, 7);
+    ASSERT_EQ(100, cloud.size());
+    ASSERT_EQ(cloud, gen::uniformCloud(100, 3, 7));
+    ASSERT_NE(cloud, gen::uniformCloud(100, 3, 8));
+    ASSERT_EQ(300, gen::flatten(cloud).size());
+
+    for (const std::vector<double>& p : gen::sphereCloud(50, 4, 0, 1)) {
+        ASSERT_NEAR(1, std::inner_product(p.begin(), p.end(), p.begin(), 0.0), 1e-9);
+    }
+    for (const std::vector<double>& p : gen::torusCloud(50, 2, 0.5, 0, 1)) {
+        const double ring = std::sqrt(p[0]*p[0] + p[1]*p[1]) - 2;
+        ASSERT_NEAR(0.25, ring*ring + p[2]*p[2], 1e-9);
+    }
+}
+
+TEST(Generators, ripsCech) {
+    // an equilateral triangle with side 1
+    const gen::PointCloud triangle = { { 0, 0 }, { 1, 0 }, { 0.5, std::sqrt(3)/2 } };
+
+    auto rips = gen::ripsComplex(triangle, 1, 2);
+    auto cech = gen::cechComplex(triangle, 1, 2);
+    rips.finalize();
+    cech.finalize();
+
+    ASSERT_EQ(7, rips.size());
+    ASSERT_EQ(7, cech.size());
+    ASSERT_TRUE(rips.verify());
+    ASSERT_TRUE(cech.verify());
+
+    const top::Simplex<int> tri = { 0, 1, 2 };
+    ASSERT_NEAR(0.5, rips.getTime(tri).step(), 1e-9);
+    ASSERT_NEAR(1/std::sqrt(3), cech.getTime(tri).step(), 1e-9);
+
+    // the triangle is too big for the cech complex, but not for the rips complex
+    auto small_cech = gen::cechComplex(triangle, 0.55, 2);
+    auto small_rips = gen::ripsComplex(triangle, 0.55, 2);
+    small_cech.finalize();
+    small_rips.finalize();
+    ASSERT_EQ(6, small_cech.size());
+    ASSERT_EQ(7, small_rips.size());
+}
+
+TEST(Generators, randomBoundary) {
+    auto C = gen::randomComplex(30, 0.3, 2, 10, 3);
+    C.finalize();
+    ASSERT_TRUE(C.verify());
+
+    const auto D = gen::randomBoundary<num::binary>(30, 0.3, 2, 10, 3);
+    ASSERT_EQ(C.size(), D.cols());
+
+    // the boundary has to be a valid input for the module
+    std::vector<std::pair<ts::tstep,ts::tstep>> barcode;
+    toprep::Module<num::binary,ts::tstep> module(D);
+    module.getBarcode(barcode);
+}
+
+TEST(Generators, randomFilteredMatrix) {
+    // a single entry per column, which has to be nonzero in every field
+    const auto D = gen::randomFilteredMatrix<num::binary>(40, 1, 11);
+    for (int colN = 1; colN < D.cols(); colN++) {
+        ASSERT_EQ(1u, D[colN].getVector().size());
+    }
+}
@@ -1,3 +1,5 @@
+#include <random>
+
 #include "linalg.h"
 #include "except.h"
 
@@ -307,6 +309,50 @@ TEST(Matrix, zeroRows) {
     ASSERT_EQ(A, A_expected);
 }
 
+TEST(Matrix, clearMasks) {
+    const TernaryMatrix A_original = {
+        {
+            { 1, 0, 0, 1, 0 },
+            { 0, 1, 0, 1, 0 },
+            { 0, 1, 1, 0, 1 },
+            { 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 1, 0 }
+        },
+        { 0, 1, 2, 3, 4 },
+        { 0, 1, 2, 3, 4 }
+    };
+    const TernaryMatrix B = {
+        { 1, 2 },
+        { 0, 1 },
+        { 1, 0 },
+        { 2, 1 },
+        { 1, 1 }
+    };
+
+    TernaryMatrix A = A_original;
+    ASSERT_FALSE(A.isReducedForm());
+
+    A.zeroRows({ 1, 4 });
+    A.zeroColumns({ 2 });
+    ASSERT_TRUE(A.hasMasks());
+    ASSERT_FALSE(A.isReducedForm());
+    A.zeroColumns({ 3, 4 });
+    ASSERT_TRUE(A.isReducedForm());
+    ASSERT_EQ(0, A(4, 3));
+
+    // the products have to agree with the rewritten matrix
+    TernaryMatrix A_applied = A;
+    A_applied.applyMasks();
+    ASSERT_FALSE(A_applied.hasMasks());
+    ASSERT_EQ(A_applied, A);
+    ASSERT_EQ(A_applied * B, A * B);
+
+    // the original data is restored
+    A.clearMasks();
+    ASSERT_FALSE(A.hasMasks());
+    ASSERT_EQ(A_original, A);
+}
+
 TEST(Matrix, multiply) {
     BinaryMatrix I = {
         {1, 0, 0},
@@ -673,3 +719,36 @@ TEST(IVector, equals) {
     ASSERT_NE(not_expected_A1_V1, A[1]);
     ASSERT_NE(not_expected_A1_V1, expected_A1);
 }
+
+TEST(Matrix, decomposeLongColumns) {
+    // dense enough for the columns to switch to the dense representation
+    const int dim = 400;
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> value(0, 5);
+
+    std::vector<tstep> times;
+    for (int i = 0; i < dim; i++) { times.push_back(i); }
+
+    TernaryMatrix D(dim, dim, times, times);
+    for (int colN = 0; colN < dim; colN++) {
+        for (int rowN = 0; rowN < colN; rowN++) {
+            const int val = value(gen);
+            if (val < 2) { D.lazyAppend(rowN, colN, val + 1); }
+        }
+    }
+
+    TernaryMatrix kernel, image;
+    D.decompose(kernel, image);
+    ASSERT_TRUE(image.isReducedForm());
+    ASSERT_EQ(dim, kernel.cols() + image.cols());
+
+    TernaryMatrix product;  D.multiply(kernel, product);
+    for (int colN = 0; colN < product.cols(); colN++) {
+        for (int rowN = 0; rowN < product.rows(); rowN++) {
+            ASSERT_EQ(0, product(rowN, colN).value());
+        }
+    }
+
+    TernaryMatrix reduced = D;  reduced.reduce(true);
+    ASSERT_EQ(image, reduced);
+}
@@ -0,0 +1,198 @@
+#include <map>
+#include <random>
+
+#include "meb.h"
+#include "filtration.h"
+#include "Miniball.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+    double miniballRadius(const int& dim, const std::vector<const double*>& points) {
+        using MB = Miniball::Miniball<Miniball::CoordAccessor<const double* const*, const double*>>;
+        const MB mb(dim, points.data(), points.data() + points.size());
+        return mb.squared_radius();
+    }
+
+    // compares the kernels with Miniball on random point sets of all sizes up to 5
+    template <int D>
+    void compareWithMiniball(const unsigned& seed) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> coord(-1, 1);
+
+        std::vector<std::vector<double>> coords(5, std::vector<double>(D));
+        std::vector<const double*> points;
+        for (int trial = 0; trial < 2000; trial++) {
+            for (std::vector<double>& p : coords) {
+                for (double& x : p) { x = coord(gen); }
+            }
+            for (int k = 1; k <= 5; k++) {
+                points.clear();
+                for (int i = 0; i < k; i++) { points.push_back(coords[i].data()); }
+
+                const double expected = miniballRadius(D, points);
+                ASSERT_NEAR(expected, meb::squaredRadius<D>(points.data(), k), 1e-9 * (1 + expected));
+            }
+        }
+    }
+}
+
+namespace {
+    // checks that no simplex of the Cech filtration of the points gets a smaller value
+    // than its facets (exactly, the filtrations need the face order)
+    template <int D>
+    void checkMonotone(const std::vector<std::vector<double>>& points, const int& max_k) {
+        const int n = points.size();
+        std::vector<double> coords;
+        for (const std::vector<double>& point : points) { coords.insert(coords.end(), point.begin(), point.end()); }
+
+        // all the subsets of up to max_k points by their bitmasks
+        std::vector<std::vector<int>> faces(max_k);
+        for (long mask = 1; mask < (1L << n); mask++) {
+            std::vector<int> simplex;
+            for (int i = 0; i < n; i++) {
+                if (mask & (1L << i)) { simplex.push_back(i); }
+            }
+            if (int(simplex.size()) <= max_k) { faces[simplex.size()-1].insert(faces[simplex.size()-1].end(), simplex.begin(), simplex.end()); }
+        }
+
+        auto C = filtration::cechComplex<D>(coords.data(), faces, filtration::Value::SquaredRadius);
+        C.finalize();
+        std::map<std::vector<int>,double> values;
+        for (int i = 0; i < C.size(); i++) {
+            values[std::vector<int>(C[i].begin(), C[i].end())] = C.getTime(i).step();
+        }
+        for (const auto& entry : values) {
+            const std::vector<int>& simplex = entry.first;
+            if (simplex.size() < 2) { continue; }
+
+            std::vector<const double*> vertices;
+            for (const int& v : simplex) { vertices.push_back(points[v].data()); }
+            ASSERT_NEAR(meb::squaredRadius<D>(vertices.data(), vertices.size()), entry.second, 1e-12);
+            for (size_t i = 0; i < simplex.size(); i++) {
+                std::vector<int> facet = simplex;   facet.erase(facet.begin() + i);
+                ASSERT_LE(values.at(facet), entry.second);
+            }
+        }
+    }
+}
+
+TEST(Meb, monotone) {
+    std::mt19937 gen(8);
+    std::normal_distribution<double> normal(0, 1);
+    std::uniform_real_distribution<double> jitter(-1e-13, 1e-13);
+
+    for (int trial = 0; trial < 300; trial++) {
+        // nearly cospherical points
+        std::vector<std::vector<double>> sphere(7, std::vector<double>(3));
+        for (std::vector<double>& p : sphere) {
+            double norm = 0;
+            for (double& x : p) { x = normal(gen);  norm += x*x; }
+            for (double& x : p) { x = x / std::sqrt(norm) * (1 + jitter(gen)); }
+        }
+        checkMonotone<3>(sphere, 4);
+
+        // nearly flat tetrahedra and nearly right triangles
+        std::vector<std::vector<double>> flat(6, std::vector<double>(3));
+        for (std::vector<double>& p : flat) { p = { normal(gen), normal(gen), jitter(gen) }; }
+        flat[5] = { flat[0][0] + jitter(gen), flat[1][1] + jitter(gen), jitter(gen) };
+        checkMonotone<3>(flat, 4);
+
+        // the same in four dimensions, where the simplices of 5 points go to the solver
+        std::vector<std::vector<double>> sphere4(7, std::vector<double>(4));
+        for (std::vector<double>& p : sphere4) {
+            double norm = 0;
+            for (double& x : p) { x = normal(gen);  norm += x*x; }
+            for (double& x : p) { x = x / std::sqrt(norm) * (1 + jitter(gen)); }
+        }
+        checkMonotone<4>(sphere4, 5);
+    }
+
+    // the vertices of a cube (cospherical with many right triangles)
+    std::vector<std::vector<double>> cube;
+    for (int i = 0; i < 8; i++) { cube.push_back({ double(i & 1), double((i >> 1) & 1), double((i >> 2) & 1) }); }
+    checkMonotone<3>(cube, 4);
+}
+
+TEST(Meb, miniball) {
+    compareWithMiniball<2>(1);
+    compareWithMiniball<3>(2);
+    compareWithMiniball<5>(3);
+}
+
+TEST(Meb, degenerate) {
+    const double a[] = { 0, 0, 0 }, b[] = { 1, 0, 0 }, c[] = { 2, 0, 0 }, d[] = { 1, 1, 0 };
+
+    // collinear and repeated points
+    ASSERT_DOUBLE_EQ(1, meb::squaredRadius3<3>(a, b, c));
+    ASSERT_DOUBLE_EQ(0.25, meb::squaredRadius3<3>(a, b, b));
+    ASSERT_DOUBLE_EQ(0, meb::squaredRadius3<3>(a, a, a));
+    // coplanar and a right triangle, which gets exactly the value of its hypotenuse
+    ASSERT_DOUBLE_EQ(1, meb::squaredRadius4<3>(a, b, c, d));
+    ASSERT_EQ(meb::squaredRadius2<3>(a, d), meb::squaredRadius3<3>(a, b, d));
+}
+
+TEST(Meb, batched) {
+    const std::vector<double> coords = { 0, 0,   1, 0,   0, 1,   1, 1,   3, 0 };
+    const std::vector<int> edges = { 0, 1,   0, 3,   1, 4 };
+    const std::vector<int> triangles = { 0, 1, 2,   1, 2, 4 };
+
+    std::vector<double> radii(3);
+    meb::squaredRadii<2,2>(coords.data(), edges.data(), 2, radii.data());
+    ASSERT_DOUBLE_EQ(0.25, radii[0]);
+    ASSERT_DOUBLE_EQ(0.5, radii[1]);
+    meb::squaredRadii<2,2>(coords.data() + 2, edges.data(), 1, radii.data() + 2);
+    ASSERT_DOUBLE_EQ(0.5, radii[2]);
+
+    meb::squaredRadii<2,3>(coords.data(), triangles.data(), 2, radii.data());
+    ASSERT_DOUBLE_EQ(0.5, radii[0]);
+    const double* tri[] = { &coords[2], &coords[4], &coords[8] };
+    ASSERT_EQ(meb::squaredRadius<2>(tri, 3), radii[1]);
+}
+
+// the fixed dimension solver against Miniball, one solver is reused for all the sets
+template <int D>
+void compareFixedMiniball(const unsigned& seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> coord(-1, 1);
+
+    meb::Miniball<D> mb;
+    std::vector<std::vector<double>> coords(D+3, std::vector<double>(D));
+    std::vector<const double*> points;
+    for (int trial = 0; trial < 500; trial++) {
+        for (std::vector<double>& p : coords) {
+            for (double& x : p) { x = coord(gen); }
+        }
+        // some repeated points
+        coords[1] = coords[0];
+
+        for (int k = 1; k <= D+3; k++) {
+            points.clear();
+            for (int i = 0; i < k; i++) { points.push_back(coords[i].data()); }
+
+            const double expected = miniballRadius(D, points);
+            ASSERT_NEAR(expected, mb.compute(points.data(), k), 1e-12 * (1 + expected));
+            ASSERT_LE(mb.nr_support_points(), D+1);
+            for (const double* p : points) {
+                double dist = 0;
+                for (int i = 0; i < D; i++) { dist += (p[i] - mb.center()[i]) * (p[i] - mb.center()[i]); }
+                ASSERT_LE(dist, mb.squared_radius() * (1 + 1e-9) + 1e-15);
+            }
+        }
+    }
+}
+
+TEST(Meb, fixedMiniball) {
+    compareFixedMiniball<2>(4);
+    compareFixedMiniball<3>(5);
+    compareFixedMiniball<6>(6);
+
+    // the batch interface
+    const std::vector<double> coords = { 0, 0,   2, 0,   0, 2,   1, 1 };
+    const std::vector<int> simplices = { 0, 1, 2,   0, 1, 3 };
+    std::vector<double> radii(2);
+    meb::Miniball<2> mb;
+    mb.compute(coords.data(), simplices.data(), 3, 2, radii.data());
+    ASSERT_DOUBLE_EQ(2, radii[0]);
+    ASSERT_DOUBLE_EQ(1, radii[1]);
+}
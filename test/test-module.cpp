@@ -1,4 +1,5 @@
 #include "toprep.h"
+#include "generators.h"
 
 #include "gtest/gtest.h"
 
@@ -41,3 +42,132 @@ TEST(Module, constructor) {
     ASSERT_TRUE(contains({ 2, 5 }));
     ASSERT_TRUE(contains({ 3, 4 }));
 }
+
+TEST(Module, stats) {
+    // most of the pairs are apparent, but not all of them
+    const BinaryMap boundry = gen::randomBoundary<binary>(60, 0.3, 3, 20, 5);
+
+    stats::reset();
+    BinaryModule module {boundry};
+    const stats::Stats s = stats::snapshot();
+
+    if (stats::enabled()) {
+        ASSERT_EQ(1, s.phaseCalls(stats::Phase::Decompose));
+        ASSERT_EQ(1, s.phaseCalls(stats::Phase::Solve));
+        ASSERT_GE(s.column_additions, 2);
+        ASSERT_GE(s.peak_column_length, 2);
+    }
+    else {
+        ASSERT_EQ(0, s.phaseCalls(stats::Phase::Decompose));
+        ASSERT_EQ(0, s.column_additions);
+    }
+
+    std::ostringstream json;    stats::writeJson(json, s);
+    ASSERT_EQ('{', json.str().front());
+    ASSERT_EQ('}', json.str().back());
+    ASSERT_NE(std::string::npos, json.str().find("\"decompose\":{\"seconds\":"));
+}
+
+TEST(Module, apparentPairs) {
+    const TernaryMap boundry = gen::randomBoundary<ternary>(60, 0.3, 3, 20, 5);
+
+    std::vector<std::pair<int,int>> pairs;  boundry.apparentPairs(pairs);
+    ASSERT_FALSE(pairs.empty());
+    for (const std::pair<int,int>& pair : pairs) {
+        ASSERT_LT(pair.first, pair.second);
+    }
+
+    // the barcode without the shortcut
+    std::vector<std::pair<tstep,tstep>> expected;
+    {
+        TernarySpace generators, relations;
+        boundry.decompose(generators, relations);
+        TernaryMap map;     TernaryMap::find(generators, map, relations);
+        map.getDomainImgTimeDiffs(expected);
+    }
+
+    std::vector<std::pair<tstep,tstep>> barcode;
+    TernaryModule module {boundry};
+    module.getBarcode(barcode);
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(barcode.begin(), barcode.end());
+    ASSERT_EQ(expected, barcode);
+}
+
+TEST(Module, ranks) {
+    auto C = gen::ripsComplex(gen::uniformCloud(40, 2, 3), 0.3, 2);
+    C.finalize();
+    const Map<ternary,tstepdouble> boundry = top::boundary<ternary>(C);
+
+    std::vector<tstepdouble> values;
+    const Map<ternary,tstep> ranked = rank(boundry, values);
+    ASSERT_EQ(boundry.cols(), ranked.cols());
+    for (size_t i = 1; i < values.size(); i++) {
+        ASSERT_LT(values[i-1], values[i]);
+    }
+    for (int colN = 0; colN < ranked.cols(); colN++) {
+        ASSERT_EQ(boundry.getColTime(colN), values[ranked.getColTime(colN).step()]);
+        ASSERT_EQ(boundry.getRowTime(colN), values[ranked.getRowTime(colN).step()]);
+    }
+
+    std::vector<std::pair<tstepdouble,tstepdouble>> expected, barcode;
+    Module<ternary,tstepdouble>(boundry).getBarcode(expected);
+    rankedBarcode(boundry, barcode);
+    ASSERT_EQ(expected, barcode);
+    ASSERT_TRUE(std::any_of(barcode.begin(), barcode.end(),
+                [](const std::pair<tstepdouble,tstepdouble>& bar) { return bar.second.isInfinity(); }));
+}
+
+// the reduction does not depend on the width of the times
+TEST(Module, narrowTimes) {
+    const TernaryMap boundry = gen::randomBoundary<ternary>(40, 0.3, 3, 20, 7);
+
+    std::vector<tstep16> row_times, col_times;
+    for (int rowN = 0; rowN < boundry.rows(); rowN++) { row_times.push_back(boundry.getRowTime(rowN).step()); }
+    for (int colN = 0; colN < boundry.cols(); colN++) { col_times.push_back(boundry.getColTime(colN).step()); }
+
+    std::vector<std::pair<tstep,tstep>> expected;
+    TernaryModule(boundry).getBarcode(expected);
+    std::vector<std::pair<tstep16,tstep16>> barcode;
+    Module<ternary,tstep16>(boundry.retime(row_times, col_times)).getBarcode(barcode);
+
+    ASSERT_EQ(expected.size(), barcode.size());
+    for (size_t i = 0; i < barcode.size(); i++) {
+        ASSERT_EQ(expected[i].first.step(), barcode[i].first.step());
+        ASSERT_EQ(expected[i].second.isInfinity(), barcode[i].second.isInfinity());
+        if (!barcode[i].second.isInfinity()) { ASSERT_EQ(expected[i].second.step(), barcode[i].second.step()); }
+    }
+}
+
+TEST(Module, limits) {
+    auto C = gen::ripsComplex(gen::uniformCloud(50, 2, 13), 0.3, 2);
+    C.finalize();
+    const tstepdouble max_time = 0.12, min_persistence = 0.01;
+
+    // the full barcode cut at max_time
+    std::vector<std::pair<tstepdouble,tstepdouble>> full, expected;
+    Module<binary,tstepdouble>(top::boundary<binary>(C)).getBarcode(full);
+    for (const auto& bar : full) {
+        if (max_time < bar.first) { continue; }
+        const tstepdouble death = max_time < bar.second ? tstepdouble::INF : bar.second;
+        if (death.isInfinity() || (bar.first < death && min_persistence <= death - bar.first)) {
+            expected.push_back({ bar.first, death });
+        }
+    }
+
+    const Map<binary,tstepdouble> boundry = top::boundary<binary>(C, max_time);
+    ASSERT_LT(boundry.cols(), C.size());
+    ASSERT_FALSE(max_time < boundry.getColTime(boundry.cols()-1));
+    ASSERT_LT(max_time, C.getTime(boundry.cols()));
+
+    std::vector<std::pair<tstepdouble,tstepdouble>> barcode;
+    Module<binary,tstepdouble>(boundry).getBarcode(barcode, min_persistence);
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(barcode.begin(), barcode.end());
+    ASSERT_EQ(expected, barcode);
+    ASSERT_LT(barcode.size(), full.size() / 2);
+    ASSERT_TRUE(std::any_of(barcode.begin(), barcode.end(),
+                [](const std::pair<tstepdouble,tstepdouble>& bar) { return !bar.second.isInfinity(); }));
+}
@@ -1,4 +1,5 @@
 #include "num.h"
+#include "tstep.h"
 
 #include "gtest/gtest.h"
 
@@ -53,3 +54,26 @@ TEST(num, inverse) {
         ASSERT_EQ(1, prod);
     }
 }
+
+template <typename timeunit>
+void checkTimestep() {
+    constexpr timeunit undefined, inf = timeunit::INF, t = 3;
+    static_assert(undefined.isUndefined() && !t.isUndefined() && !inf.isUndefined(), "undefined");
+    static_assert(inf.isInfinity() && !t.isInfinity(), "infinity");
+    static_assert(t < inf && t <= t && !(inf < t), "order");
+    static_assert(t + timeunit(2) == 5 && 5 == t + timeunit(2), "sum");
+
+    std::ostringstream out;     out << t << " " << inf << " " << undefined;
+    ASSERT_EQ("t3 inf undefined", out.str());
+}
+
+TEST(types, timestep) {
+    checkTimestep<ts::tstep>();
+    checkTimestep<ts::tstepdouble>();
+    checkTimestep<ts::tstep16>();
+    checkTimestep<ts::tstep32>();
+    checkTimestep<ts::tstep64>();
+    checkTimestep<ts::tstepfloat>();
+
+    static_assert(sizeof(ts::tstep16) == 2 && sizeof(ts::tstepfloat) == 4, "no overhead");
+}
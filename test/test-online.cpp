@@ -0,0 +1,37 @@
+#include "online.h"
+#include "generators.h"
+
+#include "gtest/gtest.h"
+
+// streams a Rips complex in chunks and checks the barcode after every chunk
+TEST(OnlineModule, append) {
+    auto R = gen::ripsComplex(gen::uniformCloud(40, 2, 12), 0.3, 2);
+    R.finalize();
+
+    // start with a prefix of the filtration (the prefixes are subcomplexes)
+    top::Complex<ts::tstepdouble,int> C;
+    const int start = R.size() / 4;
+    for (int i = 0; i < start; i++) { C.insert(R[i], R.getTime(i)); }
+    C.finalize();
+
+    toprep::OnlineModule<num::ternary,ts::tstepdouble> online(C);
+    ASSERT_EQ(start, online.size());
+
+    const int chunk = R.size() / 7 + 1;
+    for (int begin = start; begin < R.size(); begin += chunk) {
+        for (int i = begin; i < std::min(begin + chunk, R.size()); i++) {
+            ASSERT_EQ(i, C.append(R[i], R.getTime(i)));
+        }
+        ASSERT_TRUE(C.verify());
+        online.extend(C);
+        ASSERT_EQ(C.size(), online.size());
+
+        std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>> expected, barcode;
+        toprep::Module<num::ternary,ts::tstepdouble>(top::boundary<num::ternary>(C)).getBarcode(expected);
+        online.getBarcode(barcode);
+        std::sort(expected.begin(), expected.end());
+        std::sort(barcode.begin(), barcode.end());
+        ASSERT_EQ(expected, barcode);
+    }
+    ASSERT_EQ(R.size(), C.size());
+}
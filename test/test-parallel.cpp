@@ -0,0 +1,42 @@
+#include <atomic>
+#include <stdexcept>
+
+#include "parallel.h"
+
+#include "gtest/gtest.h"
+
+TEST(Parallel, forEach) {
+    const int threads = parallel::threadCount();
+    parallel::setThreadCount(4);
+
+    std::vector<int> hits(1000, 0);
+    parallel::forEach(hits.size(), [&](const int& i) { hits[i]++; });
+    for (const int& h : hits) { ASSERT_EQ(1, h); }
+
+    // the inner loops run on the threads of the outer one
+    std::atomic<int> total(0);
+    parallel::forEach(10, [&](const int&) {
+        parallel::forEach(10, [&](const int&) { total++; });
+    });
+    ASSERT_EQ(100, total);
+
+    ASSERT_EQ(1, parallel::chunkCount(10, 100));
+    ASSERT_EQ(16, parallel::chunkCount(1 << 20, 100));
+
+    parallel::setThreadCount(threads);
+}
+
+TEST(Parallel, exceptions) {
+    const int threads = parallel::threadCount();
+    parallel::setThreadCount(3);
+
+    std::atomic<int> done(0);
+    ASSERT_THROW(parallel::forEach(100, [&](const int& i) {
+        if (i == 17) { throw std::runtime_error("task"); }
+        done++;
+    }), std::runtime_error);
+    // the other tasks still ran
+    ASSERT_EQ(99, done);
+
+    parallel::setThreadCount(threads);
+}
@@ -167,3 +167,42 @@ TEST(TimedMap, decompose) {
         ASSERT_TRUE(boundry(kernel_vec).isZero());
     }
 }
+
+TEST(Map, sum) {
+    TernaryMap A = {
+        {
+            { 0, 0 },
+            { 1, 0 },
+            { 0, 0 },
+            { 0, 1 }
+        },
+        { 0, 0, 1, 1 },
+        { 1, 2 }
+    };
+    TernaryMap B = {
+        {
+            { 0, 1 },
+            { 1, 1 },
+            { 0, 0 },
+            { 1, 0 }
+        },
+        { 0, 0, 1, 1 },
+        { 1, 3 }
+    };
+
+    TernaryMap sum = A + B;
+    ASSERT_EQ(4, sum.rows());
+    ASSERT_EQ(3, sum.cols());
+    ASSERT_TRUE(sum.isReducedForm());
+    ASSERT_EQ(1, sum.getColTime(0));
+    ASSERT_EQ(1, sum.getColTime(1));
+    ASSERT_EQ(3, sum.getColTime(2));
+
+    TernaryMap diff = A - B;
+    ASSERT_EQ(3, diff.cols());
+    ASSERT_TRUE(diff.isReducedForm());
+
+    TernaryMap zero = B - B;
+    ASSERT_EQ(2, zero.cols());
+    ASSERT_TRUE(zero.isReducedForm());
+}
@@ -0,0 +1,129 @@
+#include <cmath>
+#include <random>
+#include <algorithm>
+
+#include "summary.h"
+#include "toprep.h"
+#include "generators.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+    diagram::Diagram randomPoints(const int& n, const unsigned& seed) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> unif(0, 1);
+        diagram::Diagram result;
+        for (int i = 0; i < n; i++) {
+            const double birth = unif(gen);
+            result.push_back({ birth, birth + unif(gen) });
+        }
+        result.push_back({ 0.5, std::numeric_limits<double>::infinity() });
+        return result;
+    }
+}
+
+// compares the landscapes and the silhouettes to their definitions
+TEST(Summary, landscape) {
+    const diagram::Diagram points = randomPoints(30, 3);
+    const summary::Grid grid = { -0.1, 1.5, 50 };
+    const int levels = 4;
+
+    std::vector<double> landscape(levels * grid.size), silhouette(grid.size);
+    summary::landscape(points, grid, levels, landscape.data());
+    summary::silhouette(points, grid, 2, silhouette.data());
+
+    for (int i = 0; i < grid.size; i++) {
+        const double t = grid.min + i * (grid.max - grid.min) / (grid.size - 1);
+        std::vector<double> tents;
+        double sum = 0, total = 0;
+        for (const std::pair<double,double>& point : points) {
+            const double death = std::isinf(point.second) ? grid.max : point.second;
+            const double tent = std::max(0.0, std::min(t - point.first, death - t));
+            tents.push_back(tent);
+            sum += std::pow(death - point.first, 2) * tent;
+            total += std::pow(death - point.first, 2);
+        }
+        std::sort(tents.rbegin(), tents.rend());
+        for (int level = 0; level < levels; level++) {
+            ASSERT_NEAR(tents[level], landscape[level*grid.size + i], 1e-12);
+        }
+        ASSERT_NEAR(sum / total, silhouette[i], 1e-12);
+    }
+
+    // the levels decrease and the empty diagram is zero
+    for (int level = 1; level < levels; level++) {
+        for (int i = 0; i < grid.size; i++) { ASSERT_LE(landscape[level*grid.size + i], landscape[(level-1)*grid.size + i]); }
+    }
+    summary::silhouette({}, grid, 1, silhouette.data());
+    ASSERT_EQ(std::vector<double>(grid.size, 0), silhouette);
+
+    // a finite death after the grid is not cut off
+    const summary::Grid before = { 0, 5, 6 };
+    std::vector<double> tent(before.size);
+    summary::landscape({ { 0, 10 } }, before, 1, tent.data());
+    ASSERT_EQ(std::vector<double>({ 0, 1, 2, 3, 4, 5 }), tent);
+}
+
+// the pixels of a single point and the mass of the image
+TEST(Summary, image) {
+    const summary::Grid births = { -2, 3, 25 }, persistences = { 0, 4, 20 };
+    const double sigma = 0.3;
+    const diagram::Diagram points = randomPoints(10, 7);
+
+    std::vector<double> image(births.size * persistences.size);
+    summary::image(points, births, persistences, sigma, 1, image.data());
+
+    const auto mass = [&](const double& x, const double& lower, const double& upper) {
+        return (std::erf((upper - x) / (sigma*std::sqrt(2.0))) - std::erf((lower - x) / (sigma*std::sqrt(2.0)))) / 2;
+    };
+    double total = 0, expected_total = 0;
+    for (int y = 0; y < persistences.size; y++) {
+        for (int x = 0; x < births.size; x++) {
+            const double bx = births.min + x * 0.2, py = persistences.min + y * 0.2;
+            double expected = 0;
+            for (const std::pair<double,double>& point : points) {
+                const double persistence = std::isinf(point.second) ? persistences.max : point.second - point.first;
+                expected += persistence * mass(point.first, bx, bx + 0.2) * mass(persistence, py, py + 0.2);
+            }
+            ASSERT_NEAR(expected, image[y*births.size + x], 1e-12);
+            total += image[y*births.size + x];
+        }
+    }
+    for (const std::pair<double,double>& point : points) {
+        const double persistence = std::isinf(point.second) ? persistences.max : point.second - point.first;
+        expected_total += persistence * mass(point.first, births.min, births.max) * mass(persistence, persistences.min, persistences.max);
+    }
+    ASSERT_NEAR(expected_total, total, 1e-9);
+}
+
+// the batches of the barcodes of random complexes are the single summaries
+TEST(Summary, batch) {
+    std::vector<diagram::Diagram> diagrams;
+    for (unsigned seed = 0; seed < 5; seed++) {
+        auto C = gen::ripsComplex(gen::uniformCloud(30, 2, seed), 0.3, 2);
+        C.finalize();
+        std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>> barcode;
+        toprep::Module<num::binary,ts::tstepdouble>(top::boundary<num::binary>(C)).getBarcode(barcode);
+        diagrams.push_back(diagram::fromBarcode(barcode));
+    }
+    diagrams.push_back({});
+
+    const summary::Grid grid = { 0, 0.4, 33 }, persistences = { 0, 0.4, 16 };
+    const int levels = 3, n = diagrams.size();
+    const int image_size = grid.size * persistences.size;
+    std::vector<double> landscapes(n * levels * grid.size), silhouettes(n * grid.size), images(n * image_size);
+    summary::landscapes(diagrams, grid, levels, landscapes.data());
+    summary::silhouettes(diagrams, grid, 1, silhouettes.data());
+    summary::images(diagrams, grid, persistences, 0.02, 1, images.data());
+
+    std::vector<double> landscape(levels * grid.size), silhouette(grid.size), image(image_size);
+    for (int diagramN = 0; diagramN < n; diagramN++) {
+        summary::landscape(diagrams[diagramN], grid, levels, landscape.data());
+        summary::silhouette(diagrams[diagramN], grid, 1, silhouette.data());
+        summary::image(diagrams[diagramN], grid, persistences, 0.02, 1, image.data());
+        ASSERT_TRUE(std::equal(landscape.begin(), landscape.end(), landscapes.begin() + diagramN * levels * grid.size));
+        ASSERT_TRUE(std::equal(silhouette.begin(), silhouette.end(), silhouettes.begin() + diagramN * grid.size));
+        ASSERT_TRUE(std::equal(image.begin(), image.end(), images.begin() + diagramN * image_size));
+    }
+    ASSERT_LT(0, *std::max_element(landscapes.begin(), landscapes.end()));
+}
@@ -1,5 +1,6 @@
 #include "geometry.h"
 #include "tstepdouble.h"
+#include "generators.h"
 #include "gtest/gtest.h"
 
 
@@ -24,3 +25,116 @@ C.finalize();
 //}
 
 
+
+// the complex of a triangulation of a convex region is contractible
+template <typename Triangulation>
+void checkDelaunayComplex(Triangulation& T) {
+	auto C = T.outputComplex();
+	const int inserted = C.size();
+	C.finalize();
+
+	// every simplex is inserted once
+	ASSERT_EQ(inserted, C.size());
+	ASSERT_TRUE(C.verify());
+
+	int euler = 0;
+	for(int i=0;i<C.size();++i){
+		euler += C[i].dim()%2==0 ? 1 : -1;
+	}
+	ASSERT_EQ(1, euler);
+}
+
+TEST(triangulation, uniqueSimplices){
+	geometricTriangulation2 T2;
+	gen::insertPoints(T2, gen::uniformCloud(200, 2, 3));
+	checkDelaunayComplex(T2);
+
+	geometricTriangulation3 T3;
+	gen::insertPoints(T3, gen::uniformCloud(200, 3, 3));
+	checkDelaunayComplex(T3);
+}
+
+// the alpha complex has the same simplices as the Cech one, each one appears
+// no earlier than its smallest enclosing ball and no later than its cofaces
+template <typename Triangulation>
+void checkAlphaComplex(Triangulation& T) {
+	auto cech = T.outputComplex();
+	auto alpha = T.outputComplex(FiltrationType::Alpha);
+	cech.finalize();
+	alpha.finalize();
+	ASSERT_EQ(cech.size(), alpha.size());
+	ASSERT_TRUE(alpha.verify());
+
+	for(int i=0;i<alpha.size();++i){
+		const top::Simplex<int> simplex = alpha[i];
+		ASSERT_GE(alpha.getTime(i).step() + 1e-9, cech.getTime(simplex).step());
+		for(int j=0;j<=simplex.dim() && simplex.dim()>0;++j){
+			ASSERT_LE(alpha.getTime(simplex.erase(j)).step(), alpha.getTime(i).step());
+		}
+	}
+}
+
+TEST(triangulation, alpha){
+	geometricTriangulation2 T2;
+	gen::insertPoints(T2, gen::uniformCloud(200, 2, 4));
+	checkAlphaComplex(T2);
+
+	geometricTriangulation3 T3;
+	gen::insertPoints(T3, gen::uniformCloud(200, 3, 4));
+	checkAlphaComplex(T3);
+}
+
+// the vertex indices are the positions in the buffer
+TEST(triangulation, bulkInsertion){
+	const gen::PointCloud points = gen::uniformCloud(300, 3, 5);
+	const std::vector<double> coords = gen::flatten(points);
+
+	geometricTriangulation3 T;
+	T.insertPoints(coords.data(), 100);
+	T.insertPoints(coords.data() + 3*100, 200);
+	auto C = T.outputComplex();
+	C.finalize();
+	ASSERT_TRUE(C.verify());
+
+	for(int i=0;i<C.size();++i){
+		const top::Simplex<int> simplex = C[i];
+		if(simplex.dim()!=1){
+			continue;
+		}
+		const std::vector<double>& a = points[*simplex.begin()];
+		const std::vector<double>& b = points[*(simplex.begin()+1)];
+		double dist = 0;
+		for(int k=0;k<3;++k){
+			dist += (a[k]-b[k])*(a[k]-b[k]);
+		}
+		ASSERT_NEAR(std::sqrt(dist)/2, C.getTime(i).step(), 1e-9);
+	}
+}
+
+TEST(triangulation, dimensionD){
+	const gen::PointCloud points = gen::uniformCloud(150, 3, 6);
+
+	// the same triangulation and indices as the 3 dimensional one
+	geometricTriangulation3 T3;
+	geometricTriangulationD<3> TD;
+	gen::insertPoints(T3, points);
+	gen::insertPoints(TD, points);
+	auto C3 = T3.outputComplex();
+	auto CD = TD.outputComplex();
+	C3.finalize();
+	CD.finalize();
+	ASSERT_EQ(C3.size(), CD.size());
+	for(int i=0;i<CD.size();++i){
+		ASSERT_EQ(C3[i], CD[i]);
+		ASSERT_NEAR(C3.getTime(i).step(), CD.getTime(i).step(), 1e-12);
+	}
+
+	geometricTriangulationD<4> T4;
+	gen::insertPoints(T4, gen::uniformCloud(60, 4, 6));
+	checkDelaunayComplex(T4);
+	checkAlphaComplex(T4);
+
+	geometricTriangulationD<5> T5;
+	gen::insertPoints(T5, gen::uniformCloud(30, 5, 6));
+	checkDelaunayComplex(T5);
+}
@@ -51,3 +51,34 @@ TEST(Vector, sum) {
     ASSERT_EQ(TernaryVector({ 0, 1, 0, 0, 1, 2, 1, 1 }), a);
     ASSERT_EQ(TernaryVector({ 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 }), x);
 }
+
+TEST(Vector, reductionColumn) {
+    TernaryVector a = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0 };
+    TernaryVector b = { 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0 };
+    TernaryVector e = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0 };
+
+    // dense over 8 entries, sparse again under 2
+    ReductionColumn<ternary> col(12, 8);
+
+    col.load(TernaryVector(a));
+    ASSERT_TRUE(col.isDense());
+    ASSERT_EQ(9, col.size());
+    ASSERT_EQ(8, col.pivotDim());
+
+    col.addMultiple(e, 1);
+    ASSERT_EQ(10, col.pivotDim());
+    ASSERT_EQ(2, col.pivot());
+
+    col.addMultiple(b, -1);
+    ASSERT_TRUE(col.isDense());
+    ASSERT_EQ(2, col.size());
+    ASSERT_EQ(10, col.pivotDim());
+
+    col.addMultiple(e, -1);
+    ASSERT_FALSE(col.isDense());
+    ASSERT_EQ(0, col.pivotDim());
+
+    col.addMultiple(b, 2);
+    TernaryVector out(12);  col.store(out);
+    ASSERT_EQ(TernaryVector({ 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0 }), out);
+}
@@ -0,0 +1,69 @@
+#include <random>
+
+#include "vineyard.h"
+#include "generators.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+    // the bars of positive length, sorted (the zero length bars depend on how the ties are broken)
+    template <typename timeunit>
+    std::vector<std::pair<timeunit,timeunit>> positiveBars(const std::vector<std::pair<timeunit,timeunit>>& barcode) {
+        std::vector<std::pair<timeunit,timeunit>> result;
+        for (const auto& bar : barcode) {
+            if (bar.first < bar.second) { result.push_back(bar); }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // follows the Rips complex of moving points with a vineyard and checks every
+    // step against the barcode computed from scratch
+    template <typename number>
+    void checkVineyard(const unsigned& seed) {
+        const int n = 12;
+        gen::PointCloud points = gen::uniformCloud(n, 2, seed);
+
+        // all the simplices are in the complex, only their times change
+        auto C = gen::ripsComplex(points, 10, 2);
+        C.finalize();
+        toprep::Vineyard<number,ts::tstepdouble> vineyard(C);
+        ASSERT_EQ(C.size(), vineyard.size());
+
+        std::mt19937 gen(seed);
+        std::normal_distribution<double> normal(0, 1);
+        // small steps are followed by transpositions, the last one is large enough
+        // to reduce the new order from scratch
+        const std::vector<double> steps = { 0.001, 0.005, 0.001, 0.01, 1 };
+        for (const double& step : steps) {
+            for (std::vector<double>& p : points) {
+                for (double& x : p) { x += step * normal(gen); }
+            }
+
+            auto moved = gen::ripsComplex(points, 10, 2);
+            moved.finalize();
+            ASSERT_EQ(C.size(), moved.size());
+
+            std::vector<std::pair<int,ts::tstepdouble>> changes;
+            for (int i = 0; i < moved.size(); i++) { changes.push_back({ C.getIndex(moved[i]), moved.getTime(i) }); }
+            vineyard.update(changes);
+
+            std::vector<std::pair<ts::tstepdouble,ts::tstepdouble>> expected, barcode;
+            toprep::Module<number,ts::tstepdouble>(top::boundary<number>(moved)).getBarcode(expected);
+            vineyard.getBarcode(barcode);
+            ASSERT_EQ(expected.size(), barcode.size());
+            ASSERT_EQ(positiveBars(expected), positiveBars(barcode));
+
+            for (int i = 1; i < moved.size(); i++) {
+                ASSERT_LE(vineyard.getTime(C.getIndex(moved[i-1])), vineyard.getTime(C.getIndex(moved[i])));
+            }
+        }
+        ASSERT_GT(vineyard.transpositionCount(), 0);
+        ASSERT_GT(vineyard.rebuildCount(), 0);
+    }
+}
+
+TEST(Vineyard, moving) {
+    checkVineyard<num::binary>(3);
+    checkVineyard<num::ternary>(4);
+}
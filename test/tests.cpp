@@ -8,6 +8,15 @@
 #include "test-simplex.cpp"
 #include "test-complex.cpp"
 #include "test-triangulation.cpp"
+#include "test-generators.cpp"
+#include "test-meb.cpp"
+#include "test-filtration.cpp"
+#include "test-parallel.cpp"
+#include "test-bifiltration.cpp"
+#include "test-vineyard.cpp"
+#include "test-online.cpp"
+#include "test-diagram.cpp"
+#include "test-summary.cpp"
 
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);